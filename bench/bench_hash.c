@@ -0,0 +1,767 @@
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * throughput, short key latency and distribution quality of the
+ * hashers in hashers/ -- results go to stdout as JSON, progress
+ * to stderr. any arguments are extra key corpora (one key per
+ * line) measured alongside the built-in ones. the kernels are
+ * chosen at runtime, set CUTILS_SIMD to measure a lower level
+ */
+
+#include "cpu.h"
+
+#include "hashers/crc32c.h"
+#include "hashers/murmur3.h"
+#include "hashers/spooky.h"
+#include "hashers/xxh3.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_MAX_LENGTH (1 << 20)
+#define BENCH_BUDGET_NS 20000000
+#define BENCH_AVALANCHE_TRIALS 2000
+#define BENCH_ID_COUNT 1000000
+#define BENCH_PATH_COUNT 100000
+#define BENCH_VECTOR_LENGTH 4096
+
+typedef uint64_t (*bench_hasher)(const void *, size_t, uint64_t);
+
+typedef struct hasher {
+    const char *name;
+    unsigned bits;
+    bench_hasher hash;
+} hasher;
+
+typedef struct corpus {
+    const char *name;
+    char *data;
+    size_t *offsets;
+    size_t count;
+    size_t size;
+} corpus;
+
+/* reference xxh3 outputs over vector_input() prefixes */
+typedef struct xxh3_vector {
+    size_t length;
+    uint64_t seed;
+    uint64_t hash64;
+    uint64_t low;
+    uint64_t high;
+} xxh3_vector;
+
+static volatile uint64_t sink;
+
+static uint64_t hash_spooky32(const void *data, size_t length, uint64_t seed){
+    return spooky_hash32(data, length, (uint32_t)seed);
+}
+
+static uint64_t hash_spooky64(const void *data, size_t length, uint64_t seed){
+    return spooky_hash64(data, length, seed);
+}
+
+static uint64_t hash_crc32c(const void *data, size_t length, uint64_t seed){
+    return crc32c_update((uint32_t)seed, data, length);
+}
+
+static uint64_t hash_murmur3_32(const void *data, size_t length, uint64_t seed){
+    uint32_t out;
+
+    MurmurHash3_x86_32(data, (int)length, (uint32_t)seed, &out);
+
+    return out;
+}
+
+static uint64_t hash_murmur3_128(const void *data, size_t length, uint64_t seed){
+    uint64_t out[2];
+
+    MurmurHash3_x64_128(data, (int)length, (uint32_t)seed, out);
+
+    return out[0];
+}
+
+static uint64_t hash_xxh3_64(const void *data, size_t length, uint64_t seed){
+    return xxh3_hash64(data, length, seed);
+}
+
+static uint64_t hash_xxh3_128(const void *data, size_t length, uint64_t seed){
+    uint64_t low;
+
+    xxh3_hash128(data, length, seed, &low, NULL);
+
+    return low;
+}
+
+static const hasher hashers[] = {
+    { "spooky32", 32, hash_spooky32 },
+    { "spooky64", 64, hash_spooky64 },
+    { "murmur3_x86_32", 32, hash_murmur3_32 },
+    { "murmur3_x64_128", 64, hash_murmur3_128 },
+    { "xxh3_64", 64, hash_xxh3_64 },
+    { "xxh3_128", 64, hash_xxh3_128 },
+    { "crc32c", 32, hash_crc32c }
+};
+
+static const xxh3_vector xxh3_vectors[] = {
+    { 0, 0x0000000000000000ULL, 0x2d06800538d394c2ULL, 0x6001c324468d497fULL, 0x99aa06d3014798d8ULL },
+    { 0, 0x9e3779b97f4a7c15ULL, 0x602b0e2cd6662c8bULL, 0x4ca5176998171787ULL, 0xd142977a2cca554bULL },
+    { 1, 0x0000000000000000ULL, 0x4c5cca45d0f4811fULL, 0x4c5cca45d0f4811fULL, 0x495b62073ef70ca4ULL },
+    { 1, 0x9e3779b97f4a7c15ULL, 0x2f3acd3805f81de3ULL, 0x2f3acd3805f81de3ULL, 0x00a711eb5a736b26ULL },
+    { 3, 0x0000000000000000ULL, 0x6e3e2670e61106acULL, 0x6e3e2670e61106acULL, 0x390cdc5b4a895dd7ULL },
+    { 3, 0x9e3779b97f4a7c15ULL, 0xbc74611d87f659e0ULL, 0xbc74611d87f659e0ULL, 0x3f5fd00ff400ba58ULL },
+    { 4, 0x0000000000000000ULL, 0x5c4c63133443d03fULL, 0x3d668af6f2a44d77ULL, 0xaa6e2f274640a3f4ULL },
+    { 4, 0x9e3779b97f4a7c15ULL, 0x6c3753177c607de4ULL, 0xc63af37da30d5d08ULL, 0x7e5d191bd8d354e6ULL },
+    { 8, 0x0000000000000000ULL, 0xf9fd4dd0b04d78f5ULL, 0x61ddbe7f31a6100dULL, 0x6a86a3bda6af4e3dULL },
+    { 8, 0x9e3779b97f4a7c15ULL, 0xbc72d0531396303fULL, 0x8a88691d5cecb7b6ULL, 0x9b51bcd70be038f6ULL },
+    { 9, 0x0000000000000000ULL, 0x7c20df9712c26edfULL, 0x8c7b67fd458a936bULL, 0x664c7ca18afd6255ULL },
+    { 9, 0x9e3779b97f4a7c15ULL, 0x93c5aa006102daf5ULL, 0xa1e691e73aaf9ca5ULL, 0xc0dd1f12f479931bULL },
+    { 16, 0x0000000000000000ULL, 0x86abf6baccea0858ULL, 0xe2ce54a7c19c730dULL, 0x7f9a218b0425449aULL },
+    { 16, 0x9e3779b97f4a7c15ULL, 0x69d001b16ecf450aULL, 0x1097f793402c818aULL, 0xd5f6fdbf62cdc681ULL },
+    { 17, 0x0000000000000000ULL, 0xb58bf5dc5022d071ULL, 0x8d96ef110fcdebb4ULL, 0x66fc23f6439dbd77ULL },
+    { 17, 0x9e3779b97f4a7c15ULL, 0xb7c99d19be27eb69ULL, 0x553306f0d043114cULL, 0xfdb93ea9bd7c5a87ULL },
+    { 64, 0x0000000000000000ULL, 0x1291d2d4042330ddULL, 0xba7e015a54f14be1ULL, 0xe0faf20e0e0fe0ddULL },
+    { 64, 0x9e3779b97f4a7c15ULL, 0x543fa55d8db03991ULL, 0x60ce1b9d00ac1042ULL, 0x6c800fcd18b46b32ULL },
+    { 128, 0x0000000000000000ULL, 0x10d17f72c0ccba41ULL, 0xff361dec1385710aULL, 0xaec730751478556cULL },
+    { 128, 0x9e3779b97f4a7c15ULL, 0x49b81c6e0abb9305ULL, 0x18528564127001a4ULL, 0x98b7168a26969c36ULL },
+    { 129, 0x0000000000000000ULL, 0x1648bdc3db49d1a2ULL, 0x4545b3a09738e31aULL, 0x98cd36ccbb557926ULL },
+    { 129, 0x9e3779b97f4a7c15ULL, 0x5e3831b221810b00ULL, 0x54e9357c883cec48ULL, 0x03159dbf8591c495ULL },
+    { 240, 0x0000000000000000ULL, 0xb6cfaf343fab81e6ULL, 0x3f2c53e72293711fULL, 0x5293e17bf553903dULL },
+    { 240, 0x9e3779b97f4a7c15ULL, 0x76a73ec26433f82cULL, 0xfcac543705c8c541ULL, 0xde30c63ee85a3579ULL },
+    { 241, 0x0000000000000000ULL, 0x956cae592c67279eULL, 0x956cae592c67279eULL, 0xb53840fe3fedf161ULL },
+    { 241, 0x9e3779b97f4a7c15ULL, 0x2be236ba3bacf75cULL, 0x2be236ba3bacf75cULL, 0x7be6397a1dfd48ccULL },
+    { 1024, 0x0000000000000000ULL, 0x70bd377d9574f4bbULL, 0x70bd377d9574f4bbULL, 0xf69630613f24324dULL },
+    { 1024, 0x9e3779b97f4a7c15ULL, 0xd8cf6b464541f232ULL, 0xd8cf6b464541f232ULL, 0xa888bfdf08883f70ULL },
+    { 1025, 0x0000000000000000ULL, 0x66c4487c41e127a7ULL, 0x66c4487c41e127a7ULL, 0x621af7b8277effa4ULL },
+    { 1025, 0x9e3779b97f4a7c15ULL, 0x8dc3a55e9c26d886ULL, 0x8dc3a55e9c26d886ULL, 0xfafff564f3282dc7ULL },
+    { 4096, 0x0000000000000000ULL, 0x9ddd66c14af0daffULL, 0x9ddd66c14af0daffULL, 0x3e0ff38fa88a55eaULL },
+    { 4096, 0x9e3779b97f4a7c15ULL, 0xc7bc989f5d547a4dULL, 0xc7bc989f5d547a4dULL, 0x51cfb433b55fb224ULL }
+};
+
+static const char *header_names[] = {
+    "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language", "Accept-Ranges",
+    "Access-Control-Allow-Credentials", "Access-Control-Allow-Headers",
+    "Access-Control-Allow-Methods", "Access-Control-Allow-Origin",
+    "Access-Control-Expose-Headers", "Access-Control-Max-Age",
+    "Access-Control-Request-Headers", "Access-Control-Request-Method", "Age", "Allow",
+    "Alt-Svc", "Authorization", "Cache-Control", "Connection", "Content-Disposition",
+    "Content-Encoding", "Content-Language", "Content-Length", "Content-Location",
+    "Content-Range", "Content-Security-Policy", "Content-Type", "Cookie", "Date", "DNT",
+    "ETag", "Expect", "Expires", "Forwarded", "From", "Host", "If-Match",
+    "If-Modified-Since", "If-None-Match", "If-Range", "If-Unmodified-Since", "Keep-Alive",
+    "Last-Modified", "Link", "Location", "Max-Forwards", "Origin", "Pragma",
+    "Proxy-Authenticate", "Proxy-Authorization", "Range", "Referer", "Referrer-Policy",
+    "Retry-After", "Sec-Fetch-Dest", "Sec-Fetch-Mode", "Sec-Fetch-Site", "Sec-Fetch-User",
+    "Sec-WebSocket-Accept", "Sec-WebSocket-Extensions", "Sec-WebSocket-Key",
+    "Sec-WebSocket-Protocol", "Sec-WebSocket-Version", "Server", "Set-Cookie",
+    "Strict-Transport-Security", "TE", "Trailer", "Transfer-Encoding", "Upgrade",
+    "Upgrade-Insecure-Requests", "User-Agent", "Vary", "Via", "WWW-Authenticate",
+    "Warning", "X-Content-Type-Options", "X-Forwarded-For", "X-Forwarded-Host",
+    "X-Forwarded-Proto", "X-Frame-Options", "X-Request-ID", "X-Requested-With",
+    "X-XSS-Protection", "accept", "accept-encoding", "authorization", "cache-control",
+    "content-length", "content-type", "cookie", "host", "user-agent", "x-forwarded-for"
+};
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* splitmix64, so every run sees the same "random" keys */
+static uint64_t next_random(uint64_t *state){
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+static void fill_random(uint8_t *data, size_t length, uint64_t *state){
+    for (size_t i = 0; i < length; i++){
+        data[i] = (uint8_t)next_random(state);
+    }
+}
+
+/* byte i is i * 131 + 7, the input the xxh3 vectors were made from */
+static void vector_input(uint8_t *data, size_t length){
+    for (size_t i = 0; i < length; i++){
+        data[i] = (uint8_t)(i * 131 + 7);
+    }
+}
+
+/* a hasher that disagrees with its reference isn't worth timing */
+static bool check_vectors(void){
+    uint8_t input[BENCH_VECTOR_LENGTH];
+    bool passed = true;
+
+    vector_input(input, sizeof(input));
+
+    for (size_t i = 0; i < sizeof(xxh3_vectors) / sizeof(*xxh3_vectors); i++){
+        const xxh3_vector *v = &xxh3_vectors[i];
+        uint64_t low;
+        uint64_t high;
+
+        xxh3_hash128(input, v->length, v->seed, &low, &high);
+
+        if (xxh3_hash64(input, v->length, v->seed) != v->hash64 || low != v->low || high != v->high){
+            fprintf(
+                stderr,
+                "bench_hash: xxh3 vector mismatch, length %zu seed %016llx\n",
+                v->length,
+                (unsigned long long)v->seed
+            );
+
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+/* RFC 3720 B.4, then a split of vector_input() put back together */
+static bool check_crc32c(void){
+    uint8_t input[BENCH_VECTOR_LENGTH];
+    uint8_t block[32];
+    bool passed = crc32c("123456789", 9) == 0xe3069283;
+
+    memset(block, 0, sizeof(block));
+    passed = passed && crc32c(block, sizeof(block)) == 0x8a9136aa;
+
+    memset(block, 0xff, sizeof(block));
+    passed = passed && crc32c(block, sizeof(block)) == 0x62a8ab43;
+
+    for (size_t i = 0; i < sizeof(block); i++){
+        block[i] = (uint8_t)i;
+    }
+
+    passed = passed && crc32c(block, sizeof(block)) == 0x46dd794e;
+
+    vector_input(input, sizeof(input));
+
+    uint32_t whole = crc32c(input, sizeof(input));
+    uint32_t first = crc32c(input, 1000);
+
+    passed = passed && crc32c_update(first, input + 1000, sizeof(input) - 1000) == whole;
+    passed = passed && crc32c_combine(first, crc32c(input + 1000, sizeof(input) - 1000), sizeof(input) - 1000) == whole;
+
+    if (!passed){
+        fprintf(stderr, "bench_hash: crc32c vector mismatch\n");
+    }
+
+    return passed;
+}
+
+static bool corpus_add(corpus *c, const char *key, size_t length){
+    size_t used = c->count ? c->offsets[c->count] : 0;
+
+    if (!c->offsets){
+        c->offsets = malloc(2 * sizeof(*c->offsets));
+
+        if (!c->offsets){
+            return false;
+        }
+
+        c->offsets[0] = 0;
+    }
+    else if (!((c->count + 1) & c->count)){
+        /* count + 1 is a power of two, double the offsets */
+        size_t *offsets = realloc(c->offsets, 2 * (c->count + 1) * sizeof(*offsets));
+
+        if (!offsets){
+            return false;
+        }
+
+        c->offsets = offsets;
+    }
+
+    if (used + length > c->size){
+        size_t size = c->size ? c->size : 4096;
+
+        while (used + length > size){
+            size <<= 1;
+        }
+
+        char *data = realloc(c->data, size);
+
+        if (!data){
+            return false;
+        }
+
+        c->data = data;
+        c->size = size;
+    }
+
+    memcpy(c->data + used, key, length);
+
+    c->count++;
+    c->offsets[c->count] = used + length;
+
+    return true;
+}
+
+static void corpus_free(corpus *c){
+    free(c->data);
+    free(c->offsets);
+}
+
+static bool corpus_builtin(corpus *c, size_t which){
+    char key[64];
+
+    memset(c, 0, sizeof(*c));
+
+    switch (which){
+    case 0:
+        c->name = "header_names";
+
+        for (size_t i = 0; i < sizeof(header_names) / sizeof(*header_names); i++){
+            if (!corpus_add(c, header_names[i], strlen(header_names[i]))){
+                return false;
+            }
+        }
+
+        return true;
+    case 1:
+        c->name = "decimal_ids";
+
+        for (size_t i = 0; i < BENCH_ID_COUNT; i++){
+            if (!corpus_add(c, key, (size_t)snprintf(key, sizeof(key), "%zu", i))){
+                return false;
+            }
+        }
+
+        return true;
+    case 2:
+        c->name = "binary_ids";
+
+        for (uint64_t i = 0; i < BENCH_ID_COUNT; i++){
+            if (!corpus_add(c, (const char *)&i, sizeof(i))){
+                return false;
+            }
+        }
+
+        return true;
+    default:
+        c->name = "url_paths";
+
+        for (size_t i = 0; i < BENCH_PATH_COUNT; i++){
+            int length = snprintf(key, sizeof(key), "/api/v1/users/%zu/profile", i);
+
+            if (!corpus_add(c, key, (size_t)length)){
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+static bool corpus_load(corpus *c, const char *path){
+    FILE *file = fopen(path, "rb");
+
+    memset(c, 0, sizeof(*c));
+
+    c->name = path;
+
+    if (!file){
+        return false;
+    }
+
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t length;
+    bool success = true;
+
+    while (success && (length = getline(&line, &size, file)) >= 0){
+        while (length && (line[length - 1] == '\n' || line[length - 1] == '\r')){
+            length--;
+        }
+
+        success = corpus_add(c, line, (size_t)length);
+    }
+
+    free(line);
+    fclose(file);
+
+    return success && c->count;
+}
+
+static void bench_throughput(const hasher *h, const uint8_t *data){
+    printf("\"throughput\":[");
+
+    for (size_t length = 1; length <= BENCH_MAX_LENGTH; length <<= 1){
+        uint64_t start = now_ns();
+        uint64_t elapsed = 0;
+        uint64_t bytes = 0;
+        uint64_t acc = 0;
+
+        /* batches sized to about a megabyte between clock reads */
+        size_t batch = length >= BENCH_MAX_LENGTH ? 1 : BENCH_MAX_LENGTH / length;
+
+        batch = batch > 4096 ? 4096 : batch;
+
+        while (elapsed < BENCH_BUDGET_NS){
+            for (size_t i = 0; i < batch; i++){
+                acc += h->hash(data, length, i);
+            }
+
+            bytes += (uint64_t)batch * length;
+            elapsed = now_ns() - start;
+        }
+
+        sink += acc;
+
+        printf("%s{\"length\":%zu,\"gbps\":%.3f}", length > 1 ? "," : "", length,
+            (double)bytes / (double)elapsed);
+    }
+
+    printf("]");
+}
+
+static void bench_latency(const hasher *h, const uint8_t *data){
+    static const size_t lengths[] = { 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+    uint8_t key[64];
+
+    printf("\"latency\":[");
+
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(*lengths); l++){
+        size_t length = lengths[l];
+        uint64_t hash = 0;
+        uint64_t count = 0;
+        uint64_t start = now_ns();
+        uint64_t elapsed = 0;
+
+        memcpy(key, data, sizeof(key));
+
+        /* each key depends on the previous hash, so calls cannot overlap */
+        while (elapsed < BENCH_BUDGET_NS){
+            for (size_t i = 0; i < 1024; i++){
+                key[0] ^= (uint8_t)hash;
+                hash = h->hash(key, length, 0);
+            }
+
+            count += 1024;
+            elapsed = now_ns() - start;
+        }
+
+        sink += hash;
+
+        printf("%s{\"length\":%zu,\"ns\":%.2f}", l ? "," : "", length,
+            (double)elapsed / (double)count);
+    }
+
+    printf("]");
+}
+
+/* how far each output bit is from flipping half the time when one input bit flips */
+static void bench_avalanche(const hasher *h, uint64_t *state){
+    static const size_t lengths[] = { 4, 8, 16, 32, 128 };
+    uint8_t key[128];
+
+    printf("\"avalanche\":[");
+
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(*lengths); l++){
+        size_t length = lengths[l];
+        size_t inputs = length * 8;
+        uint32_t *flips = calloc(inputs * h->bits, sizeof(*flips));
+
+        if (!flips){
+            fprintf(stderr, "bench_hash: avalanche alloc failed\n");
+
+            exit(EXIT_FAILURE);
+        }
+
+        for (size_t t = 0; t < BENCH_AVALANCHE_TRIALS; t++){
+            fill_random(key, length, state);
+
+            uint64_t base = h->hash(key, length, 0);
+
+            for (size_t i = 0; i < inputs; i++){
+                key[i >> 3] ^= (uint8_t)(1 << (i & 7));
+
+                uint64_t diff = base ^ h->hash(key, length, 0);
+
+                key[i >> 3] ^= (uint8_t)(1 << (i & 7));
+
+                for (unsigned j = 0; j < h->bits; j++){
+                    flips[i * h->bits + j] += (diff >> j) & 1;
+                }
+            }
+        }
+
+        double worst = 0;
+        double total = 0;
+
+        for (size_t i = 0; i < inputs * h->bits; i++){
+            double bias = fabs(2.0 * flips[i] / BENCH_AVALANCHE_TRIALS - 1.0);
+
+            worst = bias > worst ? bias : worst;
+            total += bias;
+        }
+
+        free(flips);
+
+        printf("%s{\"length\":%zu,\"worst_bias\":%.4f,\"mean_bias\":%.4f}", l ? "," : "",
+            length, worst, total / (double)(inputs * h->bits));
+    }
+
+    printf("]");
+}
+
+/* corpus names are file paths, so they get escaped */
+static void print_string(const char *string){
+    putchar('"');
+
+    for (const unsigned char *c = (const unsigned char *)string; *c; c++){
+        if (*c == '"' || *c == '\\'){
+            printf("\\%c", *c);
+        }
+        else if (*c < 0x20){
+            printf("\\u%04x", *c);
+        }
+        else {
+            putchar(*c);
+        }
+    }
+
+    putchar('"');
+}
+
+static int compare_u64(const void *a, const void *b){
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* chi-squared of bucket counts as a z-score (about +-3 for a good hash) */
+static double bucket_z(const uint64_t *hashes, size_t count, size_t buckets, unsigned shift,
+        uint32_t *counts){
+    memset(counts, 0, buckets * sizeof(*counts));
+
+    for (size_t i = 0; i < count; i++){
+        counts[(hashes[i] >> shift) & (buckets - 1)]++;
+    }
+
+    double expected = (double)count / (double)buckets;
+    double chi = 0;
+
+    for (size_t i = 0; i < buckets; i++){
+        double d = counts[i] - expected;
+
+        chi += d * d / expected;
+    }
+
+    return (chi - (double)(buckets - 1)) / sqrt(2.0 * (double)(buckets - 1));
+}
+
+static size_t count_collisions(uint64_t *hashes, size_t count, uint64_t mask){
+    for (size_t i = 0; i < count; i++){
+        hashes[i] &= mask;
+    }
+
+    qsort(hashes, count, sizeof(*hashes), compare_u64);
+
+    size_t collisions = 0;
+
+    for (size_t i = 1; i < count; i++){
+        collisions += hashes[i] == hashes[i - 1];
+    }
+
+    return collisions;
+}
+
+static void bench_corpus(const hasher *h, const corpus *c){
+    uint64_t *hashes = malloc(c->count * sizeof(*hashes));
+    size_t buckets = 16;
+    unsigned log2 = 4;
+
+    while (buckets < c->count){
+        buckets <<= 1;
+        log2++;
+    }
+
+    uint32_t *counts = malloc(buckets * sizeof(*counts));
+
+    if (!hashes || !counts){
+        fprintf(stderr, "bench_hash: corpus alloc failed\n");
+
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < c->count; i++){
+        hashes[i] = h->hash(c->data + c->offsets[i], c->offsets[i + 1] - c->offsets[i], 0);
+    }
+
+    double low = bucket_z(hashes, c->count, buckets, 0, counts);
+    double high = bucket_z(hashes, c->count, buckets, h->bits - log2, counts);
+    double pairs = (double)c->count * (double)(c->count - 1) / 2.0;
+
+    printf("{\"name\":");
+    print_string(c->name);
+    printf(",\"keys\":%zu,\"buckets\":%zu,\"low_bits_z\":%.2f,\"high_bits_z\":%.2f,",
+        c->count, buckets, low, high);
+
+    if (h->bits == 64){
+        size_t full = count_collisions(hashes, c->count, UINT64_MAX);
+
+        printf("\"collisions64\":%zu,\"expected64\":%.3g,", full, pairs / 18446744073709551616.0);
+    }
+
+    printf("\"collisions32\":%zu,\"expected32\":%.3g}",
+        count_collisions(hashes, c->count, UINT32_MAX), pairs / 4294967296.0);
+
+    free(hashes);
+    free(counts);
+}
+
+/* per key cost of xxh3_hash64 called in a loop against xxh3_hash64_batch */
+static void bench_batch(const corpus *c){
+    const void **keys = malloc(c->count * sizeof(*keys));
+    size_t *lengths = malloc(c->count * sizeof(*lengths));
+    uint64_t *looped = malloc(c->count * sizeof(*looped));
+    uint64_t *batched = malloc(c->count * sizeof(*batched));
+
+    if (!keys || !lengths || !looped || !batched){
+        fprintf(stderr, "bench_hash: batch alloc failed\n");
+
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < c->count; i++){
+        keys[i] = c->data + c->offsets[i];
+        lengths[i] = c->offsets[i + 1] - c->offsets[i];
+    }
+
+    uint64_t rounds = 0;
+    uint64_t start = now_ns();
+    uint64_t loop = 0;
+
+    while (loop < BENCH_BUDGET_NS){
+        for (size_t i = 0; i < c->count; i++){
+            looped[i] = xxh3_hash64(keys[i], lengths[i], rounds);
+        }
+
+        rounds++;
+        loop = now_ns() - start;
+    }
+
+    double loopns = (double)loop / (double)(rounds * c->count);
+
+    rounds = 0;
+    start = now_ns();
+
+    uint64_t batch = 0;
+
+    while (batch < BENCH_BUDGET_NS){
+        xxh3_hash64_batch(keys, lengths, c->count, rounds, batched);
+
+        rounds++;
+        batch = now_ns() - start;
+    }
+
+    /* the timed runs used different seeds, so check the batch against single calls afresh */
+    xxh3_hash64_batch(keys, lengths, c->count, 0, batched);
+
+    for (size_t i = 0; i < c->count; i++){
+        if (batched[i] != xxh3_hash64(keys[i], lengths[i], 0)){
+            fprintf(stderr, "bench_hash: xxh3 batch mismatch in %s\n", c->name);
+
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    sink += looped[0];
+
+    printf("{\"name\":");
+    print_string(c->name);
+    printf(",\"keys\":%zu,\"loop_ns\":%.2f,\"batch_ns\":%.2f}", c->count, loopns,
+        (double)batch / (double)(rounds * c->count));
+
+    free(keys);
+    free(lengths);
+    free(looped);
+    free(batched);
+}
+
+int main(int argc, char **argv){
+    size_t builtins = 4;
+    size_t count = builtins + (size_t)(argc - 1);
+    corpus *corpora = calloc(count, sizeof(*corpora));
+    uint8_t *data = malloc(BENCH_MAX_LENGTH);
+    uint64_t state = 1;
+
+    if (!corpora || !data){
+        fprintf(stderr, "bench_hash: alloc failed\n");
+
+        return EXIT_FAILURE;
+    }
+
+    if (!check_vectors() || !check_crc32c()){
+        return EXIT_FAILURE;
+    }
+
+    fill_random(data, BENCH_MAX_LENGTH, &state);
+
+    for (size_t i = 0; i < count; i++){
+        bool loaded = i < builtins ? corpus_builtin(&corpora[i], i)
+            : corpus_load(&corpora[i], argv[i - builtins + 1]);
+
+        if (!loaded){
+            fprintf(stderr, "bench_hash: unable to load corpus %s\n", corpora[i].name);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* CUTILS_SIMD picks the kernels, so runs at each level can be compared */
+    printf("{\"simd\":\"%s\",\"hashers\":[", cpu_level_name(cpu_get_level()));
+
+    for (size_t i = 0; i < sizeof(hashers) / sizeof(*hashers); i++){
+        const hasher *h = &hashers[i];
+
+        fprintf(stderr, "bench_hash: %s\n", h->name);
+
+        printf("%s{\"name\":\"%s\",\"bits\":%u,", i ? "," : "", h->name, h->bits);
+
+        bench_throughput(h, data);
+        printf(",");
+        bench_latency(h, data);
+        printf(",");
+        bench_avalanche(h, &state);
+        printf(",\"corpora\":[");
+
+        for (size_t j = 0; j < count; j++){
+            printf("%s", j ? "," : "");
+            bench_corpus(h, &corpora[j]);
+        }
+
+        printf("]}");
+    }
+
+    printf("],\"xxh3_batch\":[");
+
+    for (size_t j = 0; j < count; j++){
+        printf("%s", j ? "," : "");
+        bench_batch(&corpora[j]);
+    }
+
+    printf("]}\n");
+
+    for (size_t i = 0; i < count; i++){
+        corpus_free(&corpora[i]);
+    }
+
+    free(corpora);
+    free(data);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,535 @@
+#include "chunklist.h"
+
+#include "log.h"
+#include "str.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHUNKLIST_BLOCK_BITS 10
+#define CHUNKLIST_BLOCK_SIZE ((size_t)1 << CHUNKLIST_BLOCK_BITS)
+#define CHUNKLIST_INDEX_MINIMUM_SIZE 8
+
+static logctx *logger = NULL;
+
+struct chunkindex {
+    size_t size;
+    chunkindex *next;
+    list_item *blocks[];
+};
+
+static chunkindex *index_init(size_t size){
+    chunkindex *ci = calloc(1, sizeof(*ci) + size * sizeof(*ci->blocks));
+
+    if (!ci){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] index_init() - index alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    ci->size = size;
+    ci->next = NULL;
+
+    return ci;
+}
+
+static bool item_set(list_item *i, const list_item *item){
+    i->type = item->type;
+    i->size = item->size;
+    i->data_copy = NULL;
+    i->generic_free = item->generic_free;
+
+    if (item->data){
+        i->data = item->data;
+
+        return true;
+    }
+
+    const void *data = item->data_copy;
+
+    if (item->type == L_TYPE_LIST){
+        i->data = list_copy(data);
+    }
+    else if (item->type == L_TYPE_MAP){
+        i->data = map_copy(data);
+    }
+    else if (item->type == L_TYPE_NULL){
+        i->data = NULL;
+
+        return true;
+    }
+    else if (item->type == L_TYPE_STRING){
+        i->data = malloc(item->size + 1);
+
+        if (i->data){
+            memcpy(i->data, data, item->size);
+
+            ((char *)i->data)[item->size] = '\0';
+        }
+    }
+    else {
+        i->data = malloc(item->size);
+
+        if (i->data){
+            memcpy(i->data, data, item->size);
+        }
+    }
+
+    if (!i->data){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] item_set() - item data initialization failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static void item_clear(list_item *i){
+    switch (i->type){
+    case L_TYPE_GENERIC:
+        if (i->generic_free){
+            i->generic_free(i->data);
+        }
+        else {
+            free(i->data);
+        }
+
+        break;
+    case L_TYPE_LIST:
+        list_free(i->data);
+
+        break;
+    case L_TYPE_MAP:
+        map_free(i->data);
+
+        break;
+    case L_TYPE_NULL:
+        break;
+    default:
+        free(i->data);
+    }
+
+    i->data = NULL;
+}
+
+static const list_item *get_item(const chunklist *cl, size_t pos, ltype type){
+    if (!cl){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - chunklist is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    /* acquire pairs with the release in chunklist_append */
+    size_t length = atomic_load_explicit(&cl->length, memory_order_acquire);
+
+    if (pos >= length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - position out of range\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    const chunkindex *ci = atomic_load_explicit(&cl->index, memory_order_acquire);
+    const list_item *i = &ci->blocks[pos >> CHUNKLIST_BLOCK_BITS][pos & (CHUNKLIST_BLOCK_SIZE - 1)];
+
+    if (type != L_TYPE_RESERVED_EMPTY && i->type != type){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - item type does *not* match!\n",
+            __FILE__
+        );
+    }
+
+    return i;
+}
+
+static bool add_block(chunklist *cl, size_t block){
+    chunkindex *ci = atomic_load_explicit(&cl->index, memory_order_relaxed);
+
+    if (block >= ci->size){
+        size_t newsize = ci->size << 1;
+
+        if (newsize <= ci->size){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] add_block() - newsize (%ld) <= index size (%ld) -- unable to grow index\n",
+                __FILE__,
+                newsize,
+                ci->size
+            );
+
+            return false;
+        }
+
+        chunkindex *grown = index_init(newsize);
+
+        if (!grown){
+            return false;
+        }
+
+        memcpy(grown->blocks, ci->blocks, ci->size * sizeof(*ci->blocks));
+
+        /*
+         * readers may still hold the old index so it is kept
+         * until the chunklist is emptied or free'd
+         */
+        ci->next = cl->retired;
+        cl->retired = ci;
+
+        atomic_store_explicit(&cl->index, grown, memory_order_release);
+
+        ci = grown;
+    }
+
+    ci->blocks[block] = malloc(CHUNKLIST_BLOCK_SIZE * sizeof(**ci->blocks));
+
+    if (!ci->blocks[block]){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] add_block() - block alloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static void free_retired(chunklist *cl){
+    while (cl->retired){
+        chunkindex *next = cl->retired->next;
+
+        free(cl->retired);
+
+        cl->retired = next;
+    }
+}
+
+chunklist *chunklist_init(void){
+    chunklist *cl = calloc(1, sizeof(*cl));
+
+    if (!cl){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] chunklist_init() - chunklist object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    chunkindex *ci = index_init(CHUNKLIST_INDEX_MINIMUM_SIZE);
+
+    if (!ci){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] chunklist_init() - index_init call failed\n",
+            __FILE__
+        );
+
+        free(cl);
+
+        return NULL;
+    }
+
+    atomic_init(&cl->index, ci);
+    atomic_init(&cl->length, 0);
+
+    cl->retired = NULL;
+
+    return cl;
+}
+
+size_t chunklist_get_length(const chunklist *cl){
+    if (!cl){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] chunklist_get_length() - chunklist is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return atomic_load_explicit(&cl->length, memory_order_acquire);
+}
+
+size_t chunklist_get_size(const chunklist *cl){
+    if (!cl){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] chunklist_get_size() - chunklist is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    size_t length = atomic_load_explicit(&cl->length, memory_order_acquire);
+
+    return (length + CHUNKLIST_BLOCK_SIZE - 1) & ~(CHUNKLIST_BLOCK_SIZE - 1);
+}
+
+size_t chunklist_get_item_size(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return 0;
+    }
+
+    return i->size;
+}
+
+const list_item *chunklist_get_item(const chunklist *cl, size_t pos){
+    return get_item(cl, pos, L_TYPE_RESERVED_EMPTY);
+}
+
+ltype chunklist_get_type(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return L_TYPE_RESERVED_ERROR;
+    }
+
+    return i->type;
+}
+
+bool chunklist_get_bool(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_BOOL);
+
+    if (!i){
+        return false;
+    }
+
+    return *(bool *)i->data;
+}
+
+char chunklist_get_char(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_CHAR);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(char *)i->data;
+}
+
+double chunklist_get_double(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_DOUBLE);
+
+    if (!i){
+        return 0.0;
+    }
+
+    return *(double *)i->data;
+}
+
+int64_t chunklist_get_int(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_INT);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(int64_t *)i->data;
+}
+
+uint64_t chunklist_get_uint(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_UINT);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(uint64_t *)i->data;
+}
+
+size_t chunklist_get_size_t(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_SIZE_T);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(size_t *)i->data;
+}
+
+/*
+ * READ WARNING FOR THESE FUNCTIONS IN HEADER FILE
+ */
+char *chunklist_get_string(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_STRING);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+list *chunklist_get_list(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_LIST);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+map *chunklist_get_map(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_MAP);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+void *chunklist_get_generic(const chunklist *cl, size_t pos){
+    const list_item *i = get_item(cl, pos, L_TYPE_GENERIC);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+bool chunklist_append(chunklist *cl, const list_item *item){
+    if (!cl){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] chunklist_append() - chunklist is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!item){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] chunklist_append() - item is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    size_t length = atomic_load_explicit(&cl->length, memory_order_relaxed);
+    size_t block = length >> CHUNKLIST_BLOCK_BITS;
+    size_t offset = length & (CHUNKLIST_BLOCK_SIZE - 1);
+
+    if (!offset && !add_block(cl, block)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] chunklist_append() - add_block call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    chunkindex *ci = atomic_load_explicit(&cl->index, memory_order_relaxed);
+
+    if (!item_set(&ci->blocks[block][offset], item)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] chunklist_append() - item_set call failed\n",
+            __FILE__
+        );
+
+        if (!offset){
+            free(ci->blocks[block]);
+
+            ci->blocks[block] = NULL;
+        }
+
+        return false;
+    }
+
+    /* publish the item -- readers acquire length before touching it */
+    atomic_store_explicit(&cl->length, length + 1, memory_order_release);
+
+    return true;
+}
+
+void chunklist_empty(chunklist *cl){
+    if (!cl){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] chunklist_empty() - chunklist is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    chunkindex *ci = atomic_load_explicit(&cl->index, memory_order_relaxed);
+    size_t length = atomic_load_explicit(&cl->length, memory_order_relaxed);
+
+    for (size_t pos = 0; pos < length; ++pos){
+        item_clear(&ci->blocks[pos >> CHUNKLIST_BLOCK_BITS][pos & (CHUNKLIST_BLOCK_SIZE - 1)]);
+    }
+
+    for (size_t block = 0; block < ci->size; ++block){
+        free(ci->blocks[block]);
+
+        ci->blocks[block] = NULL;
+    }
+
+    atomic_store_explicit(&cl->length, 0, memory_order_relaxed);
+
+    free_retired(cl);
+}
+
+void chunklist_free(chunklist *cl){
+    if (!cl){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] chunklist_free() - chunklist is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    chunklist_empty(cl);
+
+    free(atomic_load_explicit(&cl->index, memory_order_relaxed));
+    free(cl);
+}
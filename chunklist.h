@@ -0,0 +1,60 @@
+#ifndef CHUNKLIST_H
+#define CHUNKLIST_H
+
+#include "list.h"
+#include "map.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * append-only list stored in fixed size blocks -- items
+ * never move once appended so pointers to them stay valid
+ * and growth only copies the (small) block index.
+ *
+ * one thread may append while any number of threads read
+ * positions below chunklist_get_length()
+ */
+typedef struct chunkindex chunkindex;
+
+typedef struct chunklist {
+    _Atomic(chunkindex *) index;
+    atomic_size_t length;
+
+    chunkindex *retired;
+} chunklist;
+
+chunklist *chunklist_init(void);
+
+size_t chunklist_get_length(const chunklist *);
+size_t chunklist_get_size(const chunklist *);
+size_t chunklist_get_item_size(const chunklist *, size_t);
+
+const list_item *chunklist_get_item(const chunklist *, size_t);
+ltype chunklist_get_type(const chunklist *, size_t);
+bool chunklist_get_bool(const chunklist *, size_t);
+char chunklist_get_char(const chunklist *, size_t);
+double chunklist_get_double(const chunklist *, size_t);
+int64_t chunklist_get_int(const chunklist *, size_t);
+uint64_t chunklist_get_uint(const chunklist *, size_t);
+size_t chunklist_get_size_t(const chunklist *, size_t);
+
+/* ------------------ WARNING ------------------
+ * same rules as the list_get_* pointer functions:
+ * the data can be modified but the pointer MUST NOT
+ * be free'd and the allocated size stays the same
+ */
+char *chunklist_get_string(const chunklist *, size_t);
+list *chunklist_get_list(const chunklist *, size_t);
+map *chunklist_get_map(const chunklist *, size_t);
+void *chunklist_get_generic(const chunklist *, size_t);
+
+bool chunklist_append(chunklist *, const list_item *);
+
+/* NOT safe while other threads are reading */
+void chunklist_empty(chunklist *);
+void chunklist_free(chunklist *);
+
+#endif
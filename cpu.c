@@ -0,0 +1,150 @@
+#include "cpu.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CPU_X86
+#include <cpuid.h>
+#endif
+
+/* set alongside the features once detection has run */
+#define CPU_FEATURE_DETECTED (1u << 31)
+
+#define CPU_LEVEL_SSE2_FEATURES CPU_FEATURE_SSE2
+#define CPU_LEVEL_SSE42_FEATURES (CPU_LEVEL_SSE2_FEATURES | CPU_FEATURE_SSSE3 | CPU_FEATURE_SSE42)
+#define CPU_LEVEL_AVX2_FEATURES (CPU_LEVEL_SSE42_FEATURES | CPU_FEATURE_AVX2)
+#define CPU_LEVEL_AVX512_FEATURES (CPU_LEVEL_AVX2_FEATURES | CPU_FEATURE_AVX512)
+
+/* XMM and YMM state, then the AVX-512 opmask and upper ZMM state as well */
+#define XCR0_AVX 0x06
+#define XCR0_AVX512 0xe6
+
+static const char *level_names[] = {
+    "scalar",
+    "sse2",
+    "sse4.2",
+    "avx2",
+    "avx512"
+};
+
+static const unsigned level_features[] = {
+    0,
+    CPU_LEVEL_SSE2_FEATURES,
+    CPU_LEVEL_SSE42_FEATURES,
+    CPU_LEVEL_AVX2_FEATURES,
+    CPU_LEVEL_AVX512_FEATURES
+};
+
+/* detection always comes up with the same answer, so racing threads are harmless */
+static _Atomic unsigned features = 0;
+
+#ifdef CPU_X86
+static uint64_t read_xcr0(void){
+    uint32_t low;
+    uint32_t high;
+
+    __asm__ volatile ("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+
+    return ((uint64_t)high << 32) | low;
+}
+
+static unsigned detect(void){
+    unsigned eax;
+    unsigned ebx;
+    unsigned ecx;
+    unsigned edx;
+    unsigned found = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)){
+        return 0;
+    }
+
+    found |= edx & bit_SSE2 ? CPU_FEATURE_SSE2 : 0;
+    found |= ecx & bit_SSSE3 ? CPU_FEATURE_SSSE3 : 0;
+    found |= ecx & bit_SSE4_2 ? CPU_FEATURE_SSE42 : 0;
+
+    /* without OSXSAVE there's no xgetbv and no AVX state */
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)){
+        return found;
+    }
+
+    uint64_t xcr0 = read_xcr0();
+
+    if ((xcr0 & XCR0_AVX) != XCR0_AVX || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)){
+        return found;
+    }
+
+    found |= ebx & bit_AVX2 ? CPU_FEATURE_AVX2 : 0;
+
+    if ((xcr0 & XCR0_AVX512) == XCR0_AVX512
+            && (ebx & bit_AVX512F) && (ebx & bit_AVX512BW) && (ebx & bit_AVX512VL)){
+        found |= CPU_FEATURE_AVX512;
+    }
+
+    return found;
+}
+#else
+/* no cpuid, so only what the compiler was told is there */
+static unsigned detect(void){
+#ifdef __SSE2__
+    return CPU_FEATURE_SSE2;
+#else
+    return 0;
+#endif
+}
+#endif
+
+static unsigned apply_override(unsigned found){
+    const char *value = getenv(CPU_SIMD_ENV);
+
+    if (!value){
+        return found;
+    }
+
+    for (size_t level = 0; level < sizeof(level_names) / sizeof(*level_names); ++level){
+        if (!strcmp(value, level_names[level])){
+            return found & level_features[level];
+        }
+    }
+
+    /* not a level name, nothing is capped */
+    return found;
+}
+
+unsigned cpu_get_features(void){
+    unsigned current = atomic_load_explicit(&features, memory_order_relaxed);
+
+    if (!current){
+        current = apply_override(detect()) | CPU_FEATURE_DETECTED;
+
+        atomic_store_explicit(&features, current, memory_order_relaxed);
+    }
+
+    return current & ~CPU_FEATURE_DETECTED;
+}
+
+bool cpu_has(unsigned wanted){
+    return (cpu_get_features() & wanted) == wanted;
+}
+
+cpu_level cpu_get_level(void){
+    unsigned current = cpu_get_features();
+
+    for (size_t level = sizeof(level_features) / sizeof(*level_features) - 1; level > 0; --level){
+        if ((current & level_features[level]) == level_features[level]){
+            return (cpu_level)level;
+        }
+    }
+
+    return CPU_LEVEL_SCALAR;
+}
+
+const char *cpu_level_name(cpu_level level){
+    if ((size_t)level >= sizeof(level_names) / sizeof(*level_names)){
+        return NULL;
+    }
+
+    return level_names[level];
+}
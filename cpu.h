@@ -0,0 +1,48 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdbool.h>
+
+/* 64 bit only, where SSE2 is the baseline */
+#ifdef __x86_64__
+#define CPU_X86 1
+#endif
+
+#define CPU_FEATURE_SSE2 (1u << 0)
+#define CPU_FEATURE_SSSE3 (1u << 1)
+#define CPU_FEATURE_SSE42 (1u << 2)
+#define CPU_FEATURE_AVX2 (1u << 3)
+
+/* AVX-512 F, BW and VL together */
+#define CPU_FEATURE_AVX512 (1u << 4)
+
+#define CPU_SIMD_ENV "CUTILS_SIMD"
+
+/*
+ * each level includes the ones below it -- sse4.2 also means
+ * SSSE3, so every kernel variant has a level that picks it
+ */
+typedef enum {
+    CPU_LEVEL_SCALAR,
+    CPU_LEVEL_SSE2,
+    CPU_LEVEL_SSE42,
+    CPU_LEVEL_AVX2,
+    CPU_LEVEL_AVX512
+} cpu_level;
+
+/*
+ * what the kernels may use, detected once with cpuid (and
+ * xgetbv, so the OS must save the wider registers too). the
+ * CUTILS_SIMD environment variable (scalar, sse2, sse4.2, avx2
+ * or avx512) caps it, so every path can be tested on one
+ * machine; it can't enable anything the CPU lacks. any other
+ * value is silently ignored and leaves detection uncapped.
+ * kernels resolve their function tables from this on first
+ * use, so set the variable before the process starts
+ */
+unsigned cpu_get_features(void);
+bool cpu_has(unsigned);
+cpu_level cpu_get_level(void);
+const char *cpu_level_name(cpu_level);
+
+#endif
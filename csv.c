@@ -0,0 +1,592 @@
+#include "csv.h"
+
+#include "cpu.h"
+#include "log.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define CSV_BLOCK_SIZE 64
+#define CSV_MINIMUM_FIELDS 16
+
+typedef void (*block_scanner)(const char *, char, uint64_t *, uint64_t *);
+
+static logctx *logger = NULL;
+
+/* bit i is set when block[i] is a quote / delimiter or newline */
+static void block_masks_scalar(const char *block, char delimiter, uint64_t *quotes, uint64_t *structural){
+    *quotes = 0;
+    *structural = 0;
+
+    for (size_t pos = 0; pos < CSV_BLOCK_SIZE; ++pos){
+        *quotes |= (uint64_t)(block[pos] == '"') << pos;
+        *structural |= (uint64_t)(block[pos] == delimiter || block[pos] == '\n') << pos;
+    }
+}
+
+#ifdef __SSE2__
+static void block_masks_sse2(const char *block, char delimiter, uint64_t *quotes, uint64_t *structural){
+    __m128i quote = _mm_set1_epi8('"');
+    __m128i delim = _mm_set1_epi8(delimiter);
+    __m128i newline = _mm_set1_epi8('\n');
+
+    *quotes = 0;
+    *structural = 0;
+
+    for (size_t pos = 0; pos < CSV_BLOCK_SIZE; pos += 16){
+        __m128i chars = _mm_loadu_si128((const __m128i *)(block + pos));
+        uint32_t q = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chars, quote));
+        uint32_t s = (uint32_t)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(chars, delim), _mm_cmpeq_epi8(chars, newline))
+        );
+
+        *quotes |= (uint64_t)q << pos;
+        *structural |= (uint64_t)s << pos;
+    }
+}
+#endif
+
+#ifdef CPU_X86
+__attribute__((target("avx2")))
+static void block_masks_avx2(const char *block, char delimiter, uint64_t *quotes, uint64_t *structural){
+    __m256i quote = _mm256_set1_epi8('"');
+    __m256i delim = _mm256_set1_epi8(delimiter);
+    __m256i newline = _mm256_set1_epi8('\n');
+
+    *quotes = 0;
+    *structural = 0;
+
+    for (size_t pos = 0; pos < CSV_BLOCK_SIZE; pos += 32){
+        __m256i chars = _mm256_loadu_si256((const __m256i *)(block + pos));
+        uint32_t q = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, quote));
+        uint32_t s = (uint32_t)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chars, delim), _mm256_cmpeq_epi8(chars, newline))
+        );
+
+        *quotes |= (uint64_t)q << pos;
+        *structural |= (uint64_t)s << pos;
+    }
+}
+
+/* the whole block is one register and the compares give the masks directly */
+__attribute__((target("avx512f,avx512bw")))
+static void block_masks_avx512(const char *block, char delimiter, uint64_t *quotes, uint64_t *structural){
+    __m512i chars = _mm512_loadu_si512((const void *)block);
+
+    *quotes = _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8('"'));
+    *structural = _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8(delimiter))
+        | _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8('\n'));
+}
+#endif
+
+/* picked once from cpu_has, racing threads pick the same one */
+static block_scanner get_block_masks(void){
+    static _Atomic block_scanner scanner = NULL;
+    block_scanner current = atomic_load_explicit(&scanner, memory_order_relaxed);
+
+    if (current){
+        return current;
+    }
+
+    current = block_masks_scalar;
+
+#ifdef __SSE2__
+    if (cpu_has(CPU_FEATURE_SSE2)){
+        current = block_masks_sse2;
+    }
+#endif
+
+#ifdef CPU_X86
+    if (cpu_has(CPU_FEATURE_AVX512)){
+        current = block_masks_avx512;
+    }
+    else if (cpu_has(CPU_FEATURE_AVX2)){
+        current = block_masks_avx2;
+    }
+#endif
+
+    atomic_store_explicit(&scanner, current, memory_order_relaxed);
+
+    return current;
+}
+
+/* bit i becomes the parity of the quotes up to and including i */
+static uint64_t prefix_xor(uint64_t bits){
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+
+    return bits;
+}
+
+static size_t read_input(csv *c, char *output, size_t size){
+    if (!c->file){
+        size_t length = size < c->inputlength ? size : c->inputlength;
+
+        memcpy(output, c->input, length);
+
+        c->input += length;
+        c->inputlength -= length;
+        c->eof = !c->inputlength;
+
+        return length;
+    }
+
+    size_t length = fread(output, 1, size, c->file);
+
+    if (length < size){
+        if (ferror(c->file)){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] read_input() - fread call failed\n",
+                __FILE__
+            );
+
+            c->error = true;
+        }
+
+        c->eof = true;
+    }
+
+    return length;
+}
+
+/*
+ * moves the unfinished row to the front of the buffer (growing
+ * it when the row fills all of it) and reads after it. the row
+ * is scanned again from its start afterwards
+ */
+static bool refill(csv *c){
+    if (c->position){
+        memmove(c->buffer, c->buffer + c->position, c->length - c->position);
+
+        c->length -= c->position;
+        c->position = 0;
+    }
+
+    if (c->length == c->size){
+        size_t size = c->size << 1;
+        char *buffer = size > c->size ? realloc(c->buffer, size + CSV_BLOCK_SIZE) : NULL;
+
+        if (!buffer){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] refill() - buffer realloc failed\n",
+                __FILE__
+            );
+
+            c->error = true;
+
+            return false;
+        }
+
+        c->buffer = buffer;
+        c->size = size;
+    }
+
+    c->length += read_input(c, c->buffer + c->length, c->size - c->length);
+    c->scanning = false;
+
+    return !c->error;
+}
+
+static bool add_field(csv *c, size_t start, size_t end){
+    if (c->fieldcount == c->fieldsize){
+        string_view *fields = realloc(c->fields, c->fieldsize * 2 * sizeof(*fields));
+
+        if (!fields){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] add_field() - fields realloc failed\n",
+                __FILE__
+            );
+
+            c->error = true;
+
+            return false;
+        }
+
+        c->fields = fields;
+        c->fieldsize *= 2;
+    }
+
+    c->fields[c->fieldcount].data = c->buffer + start;
+    c->fields[c->fieldcount].length = end - start;
+    c->fieldcount++;
+
+    return true;
+}
+
+/* strips the quotes and collapses "" in place (the buffer is ours) */
+static bool unquote(string_view *field){
+    char *data = (char *)field->data;
+
+    if (!field->length || data[0] != '"'){
+        return !memchr(data, '"', field->length);
+    }
+    else if (field->length < 2 || data[field->length - 1] != '"'){
+        return false;
+    }
+
+    const char *read = data + 1;
+    const char *end = data + field->length - 1;
+    char *write = data;
+
+    while (read < end){
+        const char *quote = memchr(read, '"', (size_t)(end - read));
+        size_t run = quote ? (size_t)(quote - read) : (size_t)(end - read);
+
+        memmove(write, read, run);
+
+        write += run;
+        read += run;
+
+        if (!quote){
+            break;
+        }
+        else if (quote + 1 >= end || quote[1] != '"'){
+            return false;
+        }
+
+        *write++ = '"';
+        read += 2;
+    }
+
+    field->length = (size_t)(write - data);
+
+    return true;
+}
+
+/* a lone (possibly CR terminated) empty field */
+static bool is_blank(const csv *c){
+    const string_view *field = &c->fields[0];
+
+    return c->fieldcount == 1 && (!field->length || (field->length == 1 && field->data[0] == '\r'));
+}
+
+static bool finish_row(csv *c, bool quotes){
+    string_view *last = &c->fields[c->fieldcount - 1];
+
+    if (last->length && last->data[last->length - 1] == '\r'){
+        last->length--;
+    }
+
+    if (!quotes){
+        return true;
+    }
+
+    for (size_t index = 0; index < c->fieldcount; ++index){
+        if (!unquote(&c->fields[index])){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] finish_row() - malformed quoting in row %ld\n",
+                __FILE__,
+                c->row + 1
+            );
+
+            c->error = true;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static csv *reader_init(FILE *file, const char *input, size_t length, char delimiter){
+    /* the last block is padded with NULs so '\0' can't be one */
+    if (delimiter == '"' || delimiter == '\n' || delimiter == '\r' || delimiter == '\0'){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] reader_init() - invalid delimiter\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    csv *c = calloc(1, sizeof(*c));
+
+    if (!c){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] reader_init() - csv alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    /* the padding lets the last partial block be read as a whole one */
+    c->buffer = malloc(CSV_BUFFER_SIZE + CSV_BLOCK_SIZE);
+    c->fields = malloc(CSV_MINIMUM_FIELDS * sizeof(*c->fields));
+
+    if (!c->buffer || !c->fields){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] reader_init() - buffer initialization failed\n",
+            __FILE__
+        );
+
+        free(c->buffer);
+        free(c->fields);
+        free(c);
+
+        return NULL;
+    }
+
+    c->file = file;
+    c->input = input;
+    c->inputlength = length;
+    c->size = CSV_BUFFER_SIZE;
+    c->fieldsize = CSV_MINIMUM_FIELDS;
+    c->delimiter = delimiter;
+
+    return c;
+}
+
+csv *csv_init(const char *path, char delimiter){
+    if (!path){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] csv_init() - path is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    FILE *file = fopen(path, "rb");
+
+    if (!file){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] csv_init() - unable to open %s\n",
+            __FILE__,
+            path
+        );
+
+        return NULL;
+    }
+
+    csv *c = reader_init(file, NULL, 0, delimiter);
+
+    if (!c){
+        fclose(file);
+    }
+
+    return c;
+}
+
+csv *csv_init_string(const char *input, size_t length, char delimiter){
+    if (!input && length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] csv_init_string() - input is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    return reader_init(NULL, input, length, delimiter);
+}
+
+bool csv_next(csv *c, const string_view **fields, size_t *count){
+    if (!c || !fields || !count){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] csv_next() - csv, fields or count is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (c->error){
+        return false;
+    }
+
+    size_t start = c->position;
+    bool quotes = c->scanning && c->blockquotes;
+
+    c->fieldcount = 0;
+
+    for (;;){
+        while (!c->structural){
+            size_t next = c->scanning ? c->block + CSV_BLOCK_SIZE : c->position;
+
+            if (next + CSV_BLOCK_SIZE > c->length && !c->eof){
+                if (!refill(c)){
+                    return false;
+                }
+
+                start = c->position;
+                quotes = false;
+                c->quoted = 0;
+                c->fieldcount = 0;
+
+                continue;
+            }
+            else if (next >= c->length){
+                /* the last row has no newline after it */
+                if (start >= c->length && !c->fieldcount){
+                    return false;
+                }
+                else if (c->quoted){
+                    log_write(
+                        logger,
+                        LOG_WARNING,
+                        "[%s] csv_next() - unterminated quote in row %ld\n",
+                        __FILE__,
+                        c->row + 1
+                    );
+
+                    c->error = true;
+
+                    return false;
+                }
+
+                if (!add_field(c, start, c->length)){
+                    return false;
+                }
+
+                c->position = c->length;
+
+                if (is_blank(c) || !finish_row(c, quotes)){
+                    return false;
+                }
+
+                c->row++;
+
+                *fields = c->fields;
+                *count = c->fieldcount;
+
+                return true;
+            }
+
+            if (next + CSV_BLOCK_SIZE > c->length){
+                memset(c->buffer + c->length, 0, next + CSV_BLOCK_SIZE - c->length);
+            }
+
+            uint64_t quotemask;
+            uint64_t structural;
+
+            get_block_masks()(c->buffer + next, c->delimiter, &quotemask, &structural);
+
+            uint64_t inside = prefix_xor(quotemask) ^ c->quoted;
+
+            c->quoted = (uint64_t)0 - (inside >> 63);
+            c->structural = structural & ~inside;
+            c->blockquotes = quotemask != 0;
+            c->block = next;
+            c->scanning = true;
+
+            quotes |= c->blockquotes;
+        }
+
+        size_t end = c->block + (size_t)__builtin_ctzll(c->structural);
+
+        c->structural &= c->structural - 1;
+
+        if (!add_field(c, start, end)){
+            return false;
+        }
+
+        start = end + 1;
+
+        if (c->buffer[end] != '\n'){
+            continue;
+        }
+
+        c->position = start;
+
+        if (is_blank(c)){
+            quotes = c->blockquotes;
+            c->fieldcount = 0;
+
+            continue;
+        }
+        else if (!finish_row(c, quotes)){
+            return false;
+        }
+
+        c->row++;
+
+        *fields = c->fields;
+        *count = c->fieldcount;
+
+        return true;
+    }
+}
+
+bool csv_has_error(const csv *c){
+    if (!c){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] csv_has_error() - csv is NULL\n",
+            __FILE__
+        );
+
+        return true;
+    }
+
+    return c->error;
+}
+
+size_t csv_get_row(const csv *c){
+    if (!c){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] csv_get_row() - csv is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return c->row;
+}
+
+void csv_free(csv *c){
+    if (!c){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] csv_free() - csv is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    if (c->file){
+        fclose(c->file);
+    }
+
+    free(c->buffer);
+    free(c->fields);
+    free(c);
+}
@@ -0,0 +1,65 @@
+#ifndef CSV_H
+#define CSV_H
+
+#include "strview.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define CSV_BUFFER_SIZE (1 << 20)
+
+/*
+ * streaming RFC 4180 reader (any single byte delimiter except
+ * NUL, quote, CR or LF, so TSV too). quotes, delimiters and
+ * newlines are found 64 bytes at a time as bitmasks and a prefix
+ * xor of the quote mask hides the ones inside quoted fields.
+ *
+ * rows are handed out as views into the reader's buffer with
+ * quoting removed -- nothing is allocated per row or field and
+ * the views are only valid until the next csv_next call. CRLF
+ * line endings are accepted and blank lines are skipped
+ */
+typedef struct csv {
+    FILE *file;
+    const char *input;
+    size_t inputlength;
+
+    char *buffer;
+    size_t size;
+    size_t length;
+    size_t position;
+
+    /* structural bits of the current 64 byte block not yet used */
+    size_t block;
+    uint64_t structural;
+    uint64_t quoted;
+    bool blockquotes;
+    bool scanning;
+
+    string_view *fields;
+    size_t fieldcount;
+    size_t fieldsize;
+
+    char delimiter;
+    size_t row;
+    bool eof;
+    bool error;
+} csv;
+
+csv *csv_init(const char *, char);
+
+/* the input is read in chunks and must outlive the reader */
+csv *csv_init_string(const char *, size_t, char);
+
+/* false at the end of the input or on a malformed row */
+bool csv_next(csv *, const string_view **, size_t *);
+bool csv_has_error(const csv *);
+
+/* rows returned so far */
+size_t csv_get_row(const csv *);
+
+void csv_free(csv *);
+
+#endif
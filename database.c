@@ -1,97 +1,151 @@
 #include "database.h"
 
+#include "intern.h"
 #include "log.h"
+#include "str.h"
+#include "strbuf.h"
 
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#define DATABASE_IMPORT_BATCH 10000
+
 static logctx *logger = NULL;
 
+/* map_set_many copies out of these, so one row's worth lives per statement */
+typedef union rowvalue {
+    double doublevalue;
+    int64_t intvalue;
+} rowvalue;
+
 static bool append_rows_named(sqlite3 *db, sqlite3_stmt *stmt, list *res){
     int err = SQLITE_ROW;
 
-    do {
-        map *row = map_init();
+    /* every row's keys share one interned copy of each column name */
+    size_t columns = sqlite3_column_count(stmt);
+    size_t slots = columns ? columns : 1;
+    map_item *keys = calloc(slots, sizeof(*keys));
+    map_item *values = calloc(slots, sizeof(*values));
+    rowvalue *scalars = calloc(slots, sizeof(*scalars));
 
-        if (!row){
+    if (!keys || !values || !scalars){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] append_rows_named() - row buffers alloc failed\n",
+            __FILE__
+        );
+
+        free(keys);
+        free(values);
+        free(scalars);
+
+        return false;
+    }
+
+    for (size_t index = 0; index < columns; index++){
+        const char *cname = sqlite3_column_name(stmt, index);
+        atom name = cname ? string_intern(cname, strlen(cname)) : NULL;
+
+        if (!name){
             log_write(
                 logger,
                 LOG_ERROR,
-                "[%s] append_rows() - row initialization failed\n",
+                "[%s] append_rows_named() - unable to intern column name\n",
                 __FILE__
             );
 
+            free(keys);
+            free(values);
+            free(scalars);
+
             return false;
         }
 
-        size_t columns = sqlite3_column_count(stmt);
+        keys[index].type = M_TYPE_ATOM;
+        keys[index].size = atom_get_length(name);
+        keys[index].data_copy = name;
+    }
 
-        for (size_t index = 0; index < columns; index++){
-            if (err != SQLITE_DONE && err != SQLITE_ROW){
-                log_write(
-                    logger,
-                    LOG_WARNING,
-                    "[%s] append_rows() - sqlite3_step failed: %s\n",
-                    __FILE__,
-                    sqlite3_errmsg(db)
-                );
+    bool success = true;
 
-                map_free(row);
+    do {
+        if (err != SQLITE_DONE && err != SQLITE_ROW){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] append_rows_named() - sqlite3_step failed: %s\n",
+                __FILE__,
+                sqlite3_errmsg(db)
+            );
 
-                return false;
-            }
+            success = false;
 
-            int ctype = sqlite3_column_type(stmt, index);
-            const char *cname = sqlite3_column_name(stmt, index);
+            break;
+        }
 
-            map_item k = {0};
-            k.type = M_TYPE_STRING;
-            k.size = strlen(cname);
-            k.data_copy = cname;
+        for (size_t index = 0; index < columns; index++){
+            int ctype = sqlite3_column_type(stmt, index);
+            map_item *v = &values[index];
 
-            map_item v = {0};
+            *v = (map_item){0};
 
             if (ctype == SQLITE_FLOAT){
-                double value = sqlite3_column_double(stmt, index);
+                scalars[index].doublevalue = sqlite3_column_double(stmt, index);
 
-                v.type = M_TYPE_DOUBLE;
-                v.size = sizeof(value);
-                v.data_copy = &value;
+                v->type = M_TYPE_DOUBLE;
+                v->size = sizeof(scalars[index].doublevalue);
+                v->data_copy = &scalars[index].doublevalue;
             }
             else if (ctype == SQLITE_INTEGER){
-                int64_t value = sqlite3_column_int64(stmt, index);
+                scalars[index].intvalue = sqlite3_column_int64(stmt, index);
 
-                v.type = M_TYPE_INT;
-                v.size = sizeof(value);
-                v.data_copy = &value;
+                v->type = M_TYPE_INT;
+                v->size = sizeof(scalars[index].intvalue);
+                v->data_copy = &scalars[index].intvalue;
             }
             else if (ctype == SQLITE_NULL){
-                void *value = NULL;
-
-                v.type = M_TYPE_NULL;
-                v.size = sizeof(value);
-                v.data = value;
+                v->type = M_TYPE_NULL;
+                v->size = sizeof(void *);
+                v->data = NULL;
             }
             else {
-                const void *value = sqlite3_column_blob(stmt, index);
-
-                v.type = M_TYPE_STRING;
-                v.size = sqlite3_column_bytes(stmt, index);
-                v.data_copy = value;
+                v->type = M_TYPE_STRING;
+                v->size = sqlite3_column_bytes(stmt, index);
+                v->data_copy = sqlite3_column_blob(stmt, index);
             }
+        }
 
-            if (!map_set(row, &k, &v)){
-                log_write(
-                    logger,
-                    LOG_ERROR,
-                    "[%s] append_rows_named() - map_set call failed\n",
-                    __FILE__
-                );
+        map *row = map_init();
 
-                map_free(row);
+        if (!row){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] append_rows_named() - row initialization failed\n",
+                __FILE__
+            );
 
-                return false;
-            }
+            success = false;
+
+            break;
+        }
+
+        if (!map_set_many(row, keys, values, columns)){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] append_rows_named() - map_set_many call failed\n",
+                __FILE__
+            );
+
+            map_free(row);
+
+            success = false;
+
+            break;
         }
 
         list_item item = {0};
@@ -109,11 +163,17 @@ static bool append_rows_named(sqlite3 *db, sqlite3_stmt *stmt, list *res){
 
             map_free(row);
 
-            return false;
+            success = false;
+
+            break;
         }
     } while ((err = sqlite3_step(stmt)) == SQLITE_ROW);
 
-    return true;
+    free(keys);
+    free(values);
+    free(scalars);
+
+    return success;
 }
 
 static bool append_rows(sqlite3 *db, sqlite3_stmt *stmt, list *res){
@@ -154,19 +214,23 @@ static bool append_rows(sqlite3 *db, sqlite3_stmt *stmt, list *res){
 
             list_item item = {0};
 
+            /* list_append copies from these, so they have to outlive the branches */
+            double doublevalue;
+            int64_t intvalue;
+
             if (ctype == SQLITE_FLOAT){
-                double value = sqlite3_column_double(stmt, index);
+                doublevalue = sqlite3_column_double(stmt, index);
 
                 item.type = L_TYPE_DOUBLE;
-                item.size = sizeof(value);
-                item.data_copy = &value;
+                item.size = sizeof(doublevalue);
+                item.data_copy = &doublevalue;
             }
             else if (ctype == SQLITE_INTEGER){
-                int64_t value = sqlite3_column_int64(stmt, index);
+                intvalue = sqlite3_column_int64(stmt, index);
 
                 item.type = L_TYPE_INT;
-                item.size = sizeof(value);
-                item.data_copy = &value;
+                item.size = sizeof(intvalue);
+                item.data_copy = &intvalue;
             }
             else if (ctype == SQLITE_NULL){
                 void *value = NULL;
@@ -434,6 +498,222 @@ bool database_execute(sqlite3 *db, const char *sql, const list *params, list **r
     return success;
 }
 
+static bool append_identifier(strbuf *sb, string_view name){
+    if (!strbuf_append_char(sb, '"')){
+        return false;
+    }
+
+    for (size_t pos = 0; pos < name.length; ++pos){
+        /* quotes inside an identifier are doubled */
+        if (name.data[pos] == '"' && !strbuf_append_char(sb, '"')){
+            return false;
+        }
+
+        if (!strbuf_append_char(sb, name.data[pos])){
+            return false;
+        }
+    }
+
+    return strbuf_append_char(sb, '"');
+}
+
+static strbuf *create_insert(const char *table, const string_view *columns, size_t count, bool named){
+    strbuf *sb = strbuf_init(0);
+
+    if (!sb){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] create_insert() - strbuf initialization failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    bool success = strbuf_append_string(sb, "INSERT INTO ") &&
+        append_identifier(sb, string_view_from_string(table));
+
+    for (size_t index = 0; named && success && index < count; ++index){
+        success = strbuf_append_string(sb, index ? ", " : " (") &&
+            append_identifier(sb, columns[index]);
+    }
+
+    if (named && success){
+        success = strbuf_append_char(sb, ')');
+    }
+
+    success = success && strbuf_append_string(sb, " VALUES (");
+
+    for (size_t index = 0; success && index < count; ++index){
+        success = strbuf_append_string(sb, index ? ", ?" : "?");
+    }
+
+    if (!success || !strbuf_append_char(sb, ')')){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] create_insert() - unable to build the insert statement\n",
+            __FILE__
+        );
+
+        strbuf_free(sb);
+
+        return NULL;
+    }
+
+    return sb;
+}
+
+static bool execute_simple(sqlite3 *db, const char *sql){
+    if (sqlite3_exec(db, sql, NULL, NULL, NULL) != SQLITE_OK){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] execute_simple() - %s failed: %s\n",
+            __FILE__,
+            sql,
+            sqlite3_errmsg(db)
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static bool insert_row(sqlite3 *db, sqlite3_stmt *stmt, const string_view *fields, size_t count){
+    for (size_t index = 0; index < count; ++index){
+        if (fields[index].length > INT_MAX){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] insert_row() - field is too long\n",
+                __FILE__
+            );
+
+            return false;
+        }
+
+        /* the views stay valid until the next row is read, after the step */
+        if (sqlite3_bind_text(stmt, index + 1, fields[index].data, (int)fields[index].length, SQLITE_STATIC) != SQLITE_OK){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] insert_row() - binding failed: %s\n",
+                __FILE__,
+                sqlite3_errmsg(db)
+            );
+
+            return false;
+        }
+    }
+
+    int err = sqlite3_step(stmt);
+
+    sqlite3_reset(stmt);
+
+    if (err != SQLITE_DONE){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] insert_row() - sqlite3_step call failed: %s\n",
+            __FILE__,
+            sqlite3_errmsg(db)
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+bool database_import_csv(sqlite3 *db, const char *table, csv *reader, bool header){
+    if (!db || !table || !reader){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] database_import_csv() - database, table or reader is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    const string_view *fields;
+    size_t count;
+
+    if (!csv_next(reader, &fields, &count)){
+        return !csv_has_error(reader);
+    }
+
+    strbuf *sql = create_insert(table, fields, count, header);
+
+    if (!sql){
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    string_view view = strbuf_get_view(sql);
+    int err = sqlite3_prepare_v2(db, view.data, (int)view.length, &stmt, NULL);
+
+    strbuf_free(sql);
+
+    if (err != SQLITE_OK){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] database_import_csv() - sqlite3_prepare_v2 call failed: %s\n",
+            __FILE__,
+            sqlite3_errmsg(db)
+        );
+
+        return false;
+    }
+
+    size_t columns = count;
+    size_t rows = 0;
+    bool batching = sqlite3_get_autocommit(db);
+    bool success = !batching || execute_simple(db, "BEGIN");
+    bool more = success && (!header || csv_next(reader, &fields, &count));
+
+    while (success && more){
+        if (count != columns){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] database_import_csv() - row %ld has %ld fields, expected %ld\n",
+                __FILE__,
+                csv_get_row(reader),
+                count,
+                columns
+            );
+
+            success = false;
+
+            break;
+        }
+
+        success = insert_row(db, stmt, fields, count);
+
+        if (success && batching && ++rows % DATABASE_IMPORT_BATCH == 0){
+            success = execute_simple(db, "COMMIT") && execute_simple(db, "BEGIN");
+        }
+
+        more = success && csv_next(reader, &fields, &count);
+    }
+
+    success = success && !csv_has_error(reader);
+
+    sqlite3_finalize(stmt);
+
+    if (batching && !sqlite3_get_autocommit(db)){
+        success = execute_simple(db, success ? "COMMIT" : "ROLLBACK") && success;
+    }
+
+    return success;
+}
+
 void database_free(sqlite3 *db){
     if (!db){
         log_write(
@@ -1,6 +1,7 @@
 #ifndef DATABASE_H
 #define DATABASE_H
 
+#include "csv.h"
 #include "list.h"
 
 #include <sqlite3.h>
@@ -10,6 +11,16 @@ sqlite3 *database_init(const char *);
 
 bool database_execute(sqlite3 *, const char *, const list *, list **, bool);
 
+/*
+ * inserts every remaining row of the reader into the table through
+ * one prepared statement, committing every DATABASE_IMPORT_BATCH
+ * rows (unless a transaction is already open, then it is left to
+ * the caller). fields are bound as text, the header row names
+ * the columns when set. on failure the current batch is rolled
+ * back but earlier batches stay committed
+ */
+bool database_import_csv(sqlite3 *, const char *, csv *, bool);
+
 void database_free(sqlite3 *);
 
 #endif
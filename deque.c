@@ -0,0 +1,853 @@
+#include "deque.h"
+
+#include "log.h"
+#include "str.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEQUE_MINIMUM_SIZE 8
+
+#define DEQUE_SHRINK_LOAD_FACTOR 0.25
+
+static logctx *logger = NULL;
+
+static bool is_power_of_two(size_t number){
+    return number && !(number & (number - 1));
+}
+
+static size_t next_power_of_two(size_t number){
+    size_t power = DEQUE_MINIMUM_SIZE;
+
+    while (power < number && power << 1 > power){
+        power <<= 1;
+    }
+
+    return power;
+}
+
+static size_t get_index(const deque *d, size_t pos){
+    return (d->head + pos) & (d->size - 1);
+}
+
+static list_item *item_init_pointer(ltype type, size_t size, void *data, list_generic_free generic_free){
+    list_item *i = malloc(sizeof(*i));
+
+    if (!i){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] item_init_pointer() - item object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    i->type = type;
+    i->size = size;
+    i->data = data;
+    i->generic_free = generic_free;
+
+    return i;
+}
+
+static list_item *item_init(ltype type, size_t size, const void *data, list_generic_free generic_free){
+    list_item *i = malloc(sizeof(*i));
+
+    if (!i){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] item_init() - item object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    i->type = type;
+    i->size = size;
+    i->generic_free = generic_free;
+
+    if (type == L_TYPE_LIST){
+        i->data = list_copy(data);
+
+        if (!i->data){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] item_init() - list_copy call failed\n",
+                __FILE__
+            );
+
+            free(i);
+
+            return NULL;
+        }
+    }
+    else if (type == L_TYPE_MAP){
+        i->data = map_copy(data);
+
+        if (!i->data){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] item_init() - map_copy call failed\n",
+                __FILE__
+            );
+
+            free(i);
+
+            return NULL;
+        }
+    }
+    else if (type == L_TYPE_NULL){
+        i->data = NULL;
+    }
+    else if (type == L_TYPE_STRING){
+        i->data = malloc(size + 1);
+
+        if (!i->data){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] item_init() - item string alloc failed\n",
+                __FILE__
+            );
+
+            free(i);
+
+            return NULL;
+        }
+
+        memcpy(i->data, data, size);
+
+        ((char *)i->data)[size] = '\0';
+    }
+    else {
+        i->data = malloc(size);
+
+        if (!i->data){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] item_init() - item data alloc failed\n",
+                __FILE__
+            );
+
+            free(i);
+
+            return NULL;
+        }
+
+        memcpy(i->data, data, size);
+    }
+
+    return i;
+}
+
+static void item_free(list_item *i){
+    if (!i){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] item_free() - item should *not* be NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    switch (i->type){
+    case L_TYPE_GENERIC:
+        if (i->generic_free){
+            i->generic_free(i->data);
+        }
+        else {
+            free(i->data);
+        }
+
+        break;
+    case L_TYPE_LIST:
+        list_free(i->data);
+
+        break;
+    case L_TYPE_MAP:
+        map_free(i->data);
+
+        break;
+    case L_TYPE_NULL:
+        break;
+    default:
+        free(i->data);
+    }
+
+    free(i);
+}
+
+static list_item *create_item(const list_item *item){
+    if (item->data){
+        return item_init_pointer(
+            item->type,
+            item->size,
+            item->data,
+            item->generic_free
+        );
+    }
+
+    return item_init(
+        item->type,
+        item->size,
+        item->data_copy,
+        item->generic_free
+    );
+}
+
+static list_item *get_item(const deque *d, size_t pos, ltype type){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - deque is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+    else if (pos >= d->length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - position out of range\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    list_item *i = d->items[get_index(d, pos)];
+
+    if (!i){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - unable to get item\n",
+            __FILE__
+        );
+    }
+    else if (type != L_TYPE_RESERVED_EMPTY && i->type != type){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] get_item() - item type does *not* match!\n",
+            __FILE__
+        );
+    }
+
+    return i;
+}
+
+static bool check_availability(deque *d){
+    if (d->length < d->size){
+        return true;
+    }
+
+    size_t newsize = d->size << 1;
+
+    if (newsize <= d->size){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] check_availability() - newsize (%ld) <= d->size (%ld) -- unable to grow deque\n",
+            __FILE__,
+            newsize,
+            d->size
+        );
+
+        return false;
+    }
+
+    if (!deque_resize(d, newsize)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] check_availability() - deque_resize call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static void check_shrink(deque *d){
+    if (d->size <= DEQUE_MINIMUM_SIZE){
+        return;
+    }
+
+    double load = (double)d->length / (double)d->size;
+
+    if (load <= DEQUE_SHRINK_LOAD_FACTOR){
+        deque_resize(d, d->size >> 1);
+    }
+}
+
+static void take_item(list_item *i, list_item *item, const char *caller){
+    if (item){
+        item->type = i->type;
+        item->size = i->size;
+        item->data = i->data;
+        item->generic_free = i->generic_free;
+
+        if (item->data){
+            i->type = L_TYPE_NULL;
+            i->size = 0;
+            i->data = NULL;
+            i->generic_free = NULL;
+        }
+    }
+    else {
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] %s() - item is NULL -- removing but unable to assign\n",
+            __FILE__,
+            caller
+        );
+    }
+
+    item_free(i);
+}
+
+deque *deque_init(void){
+    if (!is_power_of_two(DEQUE_MINIMUM_SIZE)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_init() - DEQUE_MINIMUM_SIZE must be a power of 2\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    deque *d = calloc(1, sizeof(*d));
+
+    if (!d){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_init() - deque object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    d->head = 0;
+    d->length = 0;
+    d->size = DEQUE_MINIMUM_SIZE;
+    d->items = calloc(d->size, sizeof(*d->items));
+
+    if (!d->items){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_init() - items object alloc failed\n",
+            __FILE__
+        );
+
+        free(d);
+
+        return NULL;
+    }
+
+    return d;
+}
+
+deque *deque_copy(const deque *d){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_copy() - deque is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    deque *copy = deque_init();
+
+    if (!copy){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_copy() - deque initialization failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    if (!deque_resize(copy, d->size)){
+        deque_free(copy);
+
+        return NULL;
+    }
+
+    for (size_t index = 0; index < d->length; ++index){
+        const list_item *i = d->items[get_index(d, index)];
+
+        list_item item = {0};
+        item.type = i->type;
+        item.size = i->size;
+        item.data_copy = i->data;
+        item.generic_free = i->generic_free;
+
+        if (!deque_push_back(copy, &item)){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] deque_copy() - deque_push_back call failed\n",
+                __FILE__
+            );
+
+            deque_free(copy);
+
+            return NULL;
+        }
+    }
+
+    return copy;
+}
+
+bool deque_resize(deque *d, size_t size){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_resize() - deque is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!is_power_of_two(size) || size < DEQUE_MINIMUM_SIZE){
+        size = next_power_of_two(size);
+    }
+
+    if (size == d->size){
+        return true;
+    }
+
+    if (size < d->size){
+        /* shrinking -- drop items past the new size then compact to the front */
+        while (d->length > size){
+            item_free(d->items[get_index(d, --d->length)]);
+        }
+
+        list_item **items = malloc(size * sizeof(*items));
+
+        if (!items){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] deque_resize() - items object alloc failed\n",
+                __FILE__
+            );
+
+            return false;
+        }
+
+        for (size_t index = 0; index < d->length; ++index){
+            items[index] = d->items[get_index(d, index)];
+        }
+
+        free(d->items);
+
+        d->items = items;
+        d->head = 0;
+        d->size = size;
+
+        return true;
+    }
+
+    list_item **items = realloc(d->items, size * sizeof(*items));
+
+    if (!items){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_resize() - items object realloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    /*
+     * if the ring wraps, only the shorter of the two runs
+     * is moved -- the other stays where it is
+     */
+    if (d->head + d->length > d->size){
+        size_t front = d->size - d->head;
+        size_t back = d->length - front;
+
+        if (front <= back){
+            memmove(&items[size - front], &items[d->head], front * sizeof(*items));
+
+            d->head = size - front;
+        }
+        else {
+            memcpy(&items[d->size], items, back * sizeof(*items));
+        }
+    }
+
+    d->items = items;
+    d->size = size;
+
+    return true;
+}
+
+size_t deque_get_length(const deque *d){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_get_length() - deque is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return d->length;
+}
+
+size_t deque_get_size(const deque *d){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_get_size() - deque is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return d->size;
+}
+
+size_t deque_get_item_size(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return 0;
+    }
+
+    return i->size;
+}
+
+ltype deque_get_type(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return L_TYPE_RESERVED_ERROR;
+    }
+
+    return i->type;
+}
+
+bool deque_get_bool(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_BOOL);
+
+    if (!i){
+        return false;
+    }
+
+    return *(bool *)i->data;
+}
+
+char deque_get_char(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_CHAR);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(char *)i->data;
+}
+
+double deque_get_double(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_DOUBLE);
+
+    if (!i){
+        return 0.0;
+    }
+
+    return *(double *)i->data;
+}
+
+int64_t deque_get_int(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_INT);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(int64_t *)i->data;
+}
+
+uint64_t deque_get_uint(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_UINT);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(uint64_t *)i->data;
+}
+
+size_t deque_get_size_t(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_SIZE_T);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(size_t *)i->data;
+}
+
+/*
+ * READ WARNING FOR THESE FUNCTIONS IN HEADER FILE
+ */
+char *deque_get_string(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_STRING);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+list *deque_get_list(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_LIST);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+map *deque_get_map(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_MAP);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+void *deque_get_generic(const deque *d, size_t pos){
+    const list_item *i = get_item(d, pos, L_TYPE_GENERIC);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+bool deque_push_front(deque *d, const list_item *item){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_push_front() - deque is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!item){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_push_front() - item is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_availability(d)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_push_front() - check_availability call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    list_item *i = create_item(item);
+
+    if (!i){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_push_front() - item object initialization failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    d->head = (d->head - 1) & (d->size - 1);
+    d->items[d->head] = i;
+    d->length += 1;
+
+    return true;
+}
+
+bool deque_push_back(deque *d, const list_item *item){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_push_back() - deque is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!item){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_push_back() - item is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_availability(d)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_push_back() - check_availability call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    list_item *i = create_item(item);
+
+    if (!i){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] deque_push_back() - item object initialization failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    d->items[get_index(d, d->length)] = i;
+    d->length += 1;
+
+    return true;
+}
+
+void deque_pop_front(deque *d, list_item *item){
+    list_item *i = get_item(d, 0, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return;
+    }
+
+    d->items[d->head] = NULL;
+    d->head = (d->head + 1) & (d->size - 1);
+    d->length -= 1;
+
+    take_item(i, item, "deque_pop_front");
+    check_shrink(d);
+}
+
+void deque_pop_back(deque *d, list_item *item){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_pop_back() - deque is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    list_item *i = get_item(d, d->length - 1, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return;
+    }
+
+    d->items[get_index(d, d->length - 1)] = NULL;
+    d->length -= 1;
+
+    take_item(i, item, "deque_pop_back");
+    check_shrink(d);
+}
+
+void deque_empty(deque *d){
+    if (!d){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] deque_empty() - deque is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    for (size_t index = 0; index < d->length; ++index){
+        item_free(d->items[get_index(d, index)]);
+    }
+
+    d->head = 0;
+    d->length = 0;
+
+    deque_resize(d, DEQUE_MINIMUM_SIZE);
+}
+
+void deque_free(deque *d){
+    if (!d){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] deque_free() - deque is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    for (size_t index = 0; index < d->length; ++index){
+        item_free(d->items[get_index(d, index)]);
+    }
+
+    free(d->items);
+    free(d);
+}
@@ -0,0 +1,57 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include "list.h"
+#include "map.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * ring buffer of list_item pointers -- size is always
+ * a power of 2 so positions wrap with a mask. items
+ * use the same ltype/list_item model as list
+ */
+typedef struct deque {
+    list_item **items;
+    size_t head;
+    size_t length;
+    size_t size;
+} deque;
+
+deque *deque_init(void);
+deque *deque_copy(const deque *);
+bool deque_resize(deque *, size_t);
+
+size_t deque_get_length(const deque *);
+size_t deque_get_size(const deque *);
+size_t deque_get_item_size(const deque *, size_t);
+
+ltype deque_get_type(const deque *, size_t);
+bool deque_get_bool(const deque *, size_t);
+char deque_get_char(const deque *, size_t);
+double deque_get_double(const deque *, size_t);
+int64_t deque_get_int(const deque *, size_t);
+uint64_t deque_get_uint(const deque *, size_t);
+size_t deque_get_size_t(const deque *, size_t);
+
+/* ------------------ WARNING ------------------
+ * same rules as the list_get_* pointer functions:
+ * the data can be modified but the pointer MUST NOT
+ * be free'd and the allocated size stays the same
+ */
+char *deque_get_string(const deque *, size_t);
+list *deque_get_list(const deque *, size_t);
+map *deque_get_map(const deque *, size_t);
+void *deque_get_generic(const deque *, size_t);
+
+bool deque_push_front(deque *, const list_item *);
+bool deque_push_back(deque *, const list_item *);
+
+void deque_pop_front(deque *, list_item *);
+void deque_pop_back(deque *, list_item *);
+void deque_empty(deque *);
+void deque_free(deque *);
+
+#endif
@@ -0,0 +1,1158 @@
+#include "fmt.h"
+
+#include "log.h"
+#include "str.h"
+
+#include "hashers/xxh3.h"
+
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+/* bit i of a segment's flags is flagchars[i] */
+#define FMT_FLAG_LEFT 0x01
+
+#define FMT_SPEC_SIZE 64
+
+static logctx *logger = NULL;
+
+static _Atomic(fmt *) cache[FMT_CACHE_SIZE];
+
+/* address and contents of variadic formats seen once, see admit() */
+static _Atomic uint64_t sightings[FMT_CACHE_SIZE];
+
+static const char flagchars[] = "-+ #0'";
+
+/* counts everything but only writes what fits (size leaves room for the NUL) */
+typedef struct output {
+    char *data;
+    size_t size;
+    size_t length;
+} output;
+
+static void put(output *o, const char *data, size_t length){
+    if (o->length < o->size){
+        size_t room = o->size - o->length;
+
+        memcpy(o->data + o->length, data, length < room ? length : room);
+    }
+
+    o->length += length;
+}
+
+static void put_char(output *o, char c){
+    if (o->length < o->size){
+        o->data[o->length] = c;
+    }
+
+    o->length++;
+}
+
+static void put_i64(output *o, int64_t value){
+    /* straight into the output when a whole number always fits */
+    if (o->length + STRING_INT_SIZE <= o->size){
+        o->length += string_from_i64(value, o->data + o->length, STRING_INT_SIZE);
+
+        return;
+    }
+
+    char digits[STRING_INT_SIZE];
+
+    put(o, digits, string_from_i64(value, digits, sizeof(digits)));
+}
+
+static void put_u64(output *o, uint64_t value){
+    if (o->length + STRING_INT_SIZE <= o->size){
+        o->length += string_from_u64(value, o->data + o->length, STRING_INT_SIZE);
+
+        return;
+    }
+
+    char digits[STRING_INT_SIZE];
+
+    put(o, digits, string_from_u64(value, digits, sizeof(digits)));
+}
+
+static void put_hex(output *o, uint64_t value, bool upper){
+    const char *alphabet = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char digits[16];
+    size_t position = sizeof(digits);
+
+    do {
+        digits[--position] = alphabet[value & 0xf];
+        value >>= 4;
+    } while (value);
+
+    put(o, digits + position, sizeof(digits) - position);
+}
+
+static void put_double(output *o, double value){
+    char digits[STRING_DOUBLE_SIZE];
+
+    put(o, digits, string_from_double(value, digits, sizeof(digits)));
+}
+
+static void put_string(output *o, const char *value){
+    /* printf's rendering of a NULL string */
+    put(o, value ? value : "(null)", value ? strlen(value) : 6);
+}
+
+/* the spare room of the output handed to snprintf (terminator included) */
+static bool put_snprintf_result(output *o, int length){
+    if (length < 0){
+        return false;
+    }
+
+    o->length += (size_t)length;
+
+    return true;
+}
+
+static char *spare(const output *o, size_t *size){
+    *size = o->length < o->size ? o->size - o->length + 1 : 0;
+
+    return *size ? o->data + o->length : NULL;
+}
+
+static void finish(output *o, size_t size){
+    if (size){
+        o->data[o->length < o->size ? o->length : o->size] = '\0';
+    }
+}
+
+static bool is_integer(char conversion){
+    return strchr("diuoxX", conversion) != NULL;
+}
+
+static bool is_floating(char conversion){
+    return strchr("fFeEgGaA", conversion) != NULL;
+}
+
+static bool parse_number(const char **position, int *value){
+    long long number = 0;
+
+    while (**position >= '0' && **position <= '9'){
+        number = number * 10 + (**position - '0');
+
+        if (number > INT_MAX){
+            return false;
+        }
+
+        (*position)++;
+    }
+
+    *value = (int)number;
+
+    return true;
+}
+
+/* one conversion (after its '%') into segment, NULL when unsupported */
+static const char *parse_conversion(const char *position, fmt_segment *segment){
+    const char *flag;
+
+    memset(segment, 0, sizeof(*segment));
+
+    segment->width = -1;
+    segment->precision = -1;
+
+    while (*position && (flag = strchr(flagchars, *position))){
+        segment->flags |= (uint8_t)(1 << (flag - flagchars));
+        position++;
+    }
+
+    if (*position == '*'){
+        segment->widthargument = true;
+        position++;
+    }
+    else if (*position >= '1' && *position <= '9'){
+        if (!parse_number(&position, &segment->width) || *position == '$'){
+            return NULL;
+        }
+    }
+
+    if (*position == '.'){
+        position++;
+
+        if (*position == '*'){
+            segment->precisionargument = true;
+            position++;
+        }
+        else if (!parse_number(&position, &segment->precision)){
+            return NULL;
+        }
+    }
+
+    switch (*position){
+    case 'h':
+        position++;
+        segment->modifier = FMT_MODIFIER_SHORT;
+
+        if (*position == 'h'){
+            position++;
+            segment->modifier = FMT_MODIFIER_CHAR;
+        }
+
+        break;
+    case 'l':
+        position++;
+        segment->modifier = FMT_MODIFIER_LONG;
+
+        if (*position == 'l'){
+            position++;
+            segment->modifier = FMT_MODIFIER_LONG_LONG;
+        }
+
+        break;
+    case 'j':
+        position++;
+        segment->modifier = FMT_MODIFIER_INTMAX;
+
+        break;
+    case 'z':
+        position++;
+        segment->modifier = FMT_MODIFIER_SIZE;
+
+        break;
+    case 't':
+        position++;
+        segment->modifier = FMT_MODIFIER_PTRDIFF;
+
+        break;
+    case 'L':
+        position++;
+        segment->modifier = FMT_MODIFIER_LONG_DOUBLE;
+
+        break;
+    }
+
+    char conversion = *position;
+
+    if (!conversion || !strchr("diuoxXcspfFeEgGaAr", conversion)){
+        return NULL;
+    }
+    else if (conversion == 'r' && (segment->flags || segment->width >= 0 || segment->widthargument
+            || segment->precision >= 0 || segment->precisionargument
+            || segment->modifier != FMT_MODIFIER_NONE)){
+        return NULL;
+    }
+    else if (segment->modifier == FMT_MODIFIER_LONG_DOUBLE && !is_floating(conversion)){
+        return NULL;
+    }
+
+    segment->conversion = conversion;
+    segment->simple = !segment->flags && segment->width < 0 && !segment->widthargument
+        && segment->precision < 0 && !segment->precisionargument && conversion != 'p'
+        && !(conversion == 'c' && segment->modifier == FMT_MODIFIER_LONG)
+        && !(conversion == 's' && segment->modifier == FMT_MODIFIER_LONG)
+        && !is_floating(conversion);
+
+    return position + 1;
+}
+
+/* never logs -- used by the cache on log_write's behalf */
+static fmt *compile(const char *format){
+    size_t length = strlen(format);
+    fmt *f = calloc(1, sizeof(*f));
+
+    if (!f){
+        return NULL;
+    }
+
+    /* every segment takes at least one byte, specs are copied with a NUL */
+    f->source = malloc(length + 1);
+    f->text = malloc(length + length + 1);
+    f->segments = malloc((length + 1) * sizeof(*f->segments));
+
+    if (!f->source || !f->text || !f->segments){
+        fmt_free(f);
+
+        return NULL;
+    }
+
+    memcpy(f->source, format, length + 1);
+
+    const char *position = format;
+    char *text = f->text;
+    fmt_segment *literal = NULL;
+
+    while (*position){
+        if (*position != '%' || position[1] == '%'){
+            /* %% adds a single '%' to the current literal run */
+            size_t run = *position == '%' ? 1 : strcspn(position, "%");
+
+            if (!literal){
+                literal = &f->segments[f->length++];
+
+                memset(literal, 0, sizeof(*literal));
+
+                literal->data = text;
+            }
+
+            memcpy(text, position, run);
+
+            text += run;
+            literal->length += run;
+            position += *position == '%' ? 2 : run;
+
+            continue;
+        }
+
+        fmt_segment *segment = &f->segments[f->length];
+        const char *end = parse_conversion(position + 1, segment);
+
+        if (!end){
+            fmt_free(f);
+
+            return NULL;
+        }
+
+        /* the spec is kept NUL terminated for snprintf */
+        literal = NULL;
+        segment->data = text;
+        segment->length = (size_t)(end - position);
+
+        memcpy(text, position, segment->length);
+
+        text += segment->length;
+        *text++ = '\0';
+
+        f->arguments += 1 + segment->widthargument + segment->precisionargument;
+        f->length++;
+        position = end;
+    }
+
+    fmt_segment *segments = realloc(f->segments, (f->length ? f->length : 1) * sizeof(*segments));
+
+    if (segments){
+        f->segments = segments;
+    }
+
+    return f;
+}
+
+fmt *fmt_compile(const char *format){
+    if (!format){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_compile() - format is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    fmt *f = compile(format);
+
+    if (!f){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_compile() - unsupported format or allocation failure\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    return f;
+}
+
+size_t fmt_get_arguments(const fmt *f){
+    if (!f){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_get_arguments() - fmt is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return f->arguments;
+}
+
+static int64_t fetch_signed(va_list *args, fmt_modifier modifier){
+    switch (modifier){
+    case FMT_MODIFIER_CHAR:
+        return (signed char)va_arg(*args, int);
+    case FMT_MODIFIER_SHORT:
+        return (short)va_arg(*args, int);
+    case FMT_MODIFIER_LONG:
+        return va_arg(*args, long);
+    case FMT_MODIFIER_LONG_LONG:
+        return va_arg(*args, long long);
+    case FMT_MODIFIER_INTMAX:
+        return va_arg(*args, intmax_t);
+    case FMT_MODIFIER_SIZE:
+    case FMT_MODIFIER_PTRDIFF:
+        return va_arg(*args, ptrdiff_t);
+    default:
+        return va_arg(*args, int);
+    }
+}
+
+static uint64_t fetch_unsigned(va_list *args, fmt_modifier modifier){
+    switch (modifier){
+    case FMT_MODIFIER_CHAR:
+        return (unsigned char)va_arg(*args, unsigned int);
+    case FMT_MODIFIER_SHORT:
+        return (unsigned short)va_arg(*args, unsigned int);
+    case FMT_MODIFIER_LONG:
+        return va_arg(*args, unsigned long);
+    case FMT_MODIFIER_LONG_LONG:
+        return va_arg(*args, unsigned long long);
+    case FMT_MODIFIER_INTMAX:
+        return va_arg(*args, uintmax_t);
+    case FMT_MODIFIER_SIZE:
+    case FMT_MODIFIER_PTRDIFF:
+        return va_arg(*args, size_t);
+    default:
+        return va_arg(*args, unsigned int);
+    }
+}
+
+/* steps over what snprintf consumed from its own copy of the arguments */
+static void skip(va_list *args, const fmt_segment *segment){
+    if (segment->widthargument){
+        (void)va_arg(*args, int);
+    }
+
+    if (segment->precisionargument){
+        (void)va_arg(*args, int);
+    }
+
+    switch (segment->conversion){
+    case 'c':
+        if (segment->modifier == FMT_MODIFIER_LONG){
+            (void)va_arg(*args, wint_t);
+        }
+        else {
+            (void)va_arg(*args, int);
+        }
+
+        break;
+    case 's':
+        if (segment->modifier == FMT_MODIFIER_LONG){
+            (void)va_arg(*args, wchar_t *);
+        }
+        else {
+            (void)va_arg(*args, char *);
+        }
+
+        break;
+    case 'p':
+        (void)va_arg(*args, void *);
+
+        break;
+    default:
+        if (segment->modifier == FMT_MODIFIER_LONG_DOUBLE){
+            (void)va_arg(*args, long double);
+        }
+        else if (is_floating(segment->conversion)){
+            (void)va_arg(*args, double);
+        }
+        else {
+            (void)fetch_unsigned(args, segment->modifier);
+        }
+    }
+}
+
+static bool render_variadic(const fmt *f, output *o, va_list *args){
+    for (size_t index = 0; index < f->length; ++index){
+        const fmt_segment *segment = &f->segments[index];
+
+        if (!segment->conversion){
+            put(o, segment->data, segment->length);
+
+            continue;
+        }
+        else if (!segment->simple){
+            size_t size;
+            char *data = spare(o, &size);
+            va_list copy;
+
+            va_copy(copy, *args);
+
+            int length = vsnprintf(data, size, segment->data, copy);
+
+            va_end(copy);
+
+            if (!put_snprintf_result(o, length)){
+                return false;
+            }
+
+            skip(args, segment);
+
+            continue;
+        }
+
+        switch (segment->conversion){
+        case 'd':
+        case 'i':
+            put_i64(o, fetch_signed(args, segment->modifier));
+
+            break;
+        case 'u':
+            put_u64(o, fetch_unsigned(args, segment->modifier));
+
+            break;
+        case 'x':
+        case 'X':
+            put_hex(o, fetch_unsigned(args, segment->modifier), segment->conversion == 'X');
+
+            break;
+        case 'c':
+            put_char(o, (char)va_arg(*args, int));
+
+            break;
+        case 's':
+            put_string(o, va_arg(*args, const char *));
+
+            break;
+        case 'r':
+            put_double(o, va_arg(*args, double));
+
+            break;
+        default:
+            /* octal */
+            {
+                size_t size;
+                char *data = spare(o, &size);
+
+                if (!put_snprintf_result(o, snprintf(data, size, "%llo",
+                        (unsigned long long)fetch_unsigned(args, segment->modifier)))){
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool fits(const fmt_arg *arg, char conversion){
+    bool integer = arg->type == FMT_ARG_SIGNED || arg->type == FMT_ARG_UNSIGNED;
+
+    if (is_integer(conversion) || conversion == 'c'){
+        return integer;
+    }
+    else if (is_floating(conversion) || conversion == 'r'){
+        return arg->type == FMT_ARG_DOUBLE;
+    }
+    else if (conversion == 's'){
+        return arg->type == FMT_ARG_STRING || arg->type == FMT_ARG_VIEW;
+    }
+
+    return arg->type == FMT_ARG_POINTER || arg->type == FMT_ARG_STRING;
+}
+
+/* the value as printf's unsigned conversions would see it */
+static uint64_t as_unsigned(const fmt_arg *arg){
+    if (arg->type == FMT_ARG_UNSIGNED || arg->size >= sizeof(uint64_t)){
+        return arg->value.u;
+    }
+
+    return arg->value.u & (((uint64_t)1 << (arg->size * CHAR_BIT)) - 1);
+}
+
+static bool star(const fmt_arg *arg, int *value){
+    if (arg->type == FMT_ARG_SIGNED && arg->value.i >= INT_MIN && arg->value.i <= INT_MAX){
+        *value = (int)arg->value.i;
+
+        return true;
+    }
+    else if (arg->type == FMT_ARG_UNSIGNED && arg->value.u <= INT_MAX){
+        *value = (int)arg->value.u;
+
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * rebuilds the spec with the width and precision spelled out
+ * and the length modifier matching what is passed to snprintf
+ */
+static void build_spec(const fmt_segment *segment, int width, int precision, char conversion, char *spec){
+    uint8_t flags = segment->flags;
+    char *position = spec;
+
+    if (width < 0){
+        /* as with printf, a negative '*' width left aligns */
+        flags |= FMT_FLAG_LEFT;
+        width = width == INT_MIN ? INT_MAX : -width;
+    }
+
+    *position++ = '%';
+
+    for (size_t flag = 0; flagchars[flag]; ++flag){
+        if (flags & (1 << flag)){
+            *position++ = flagchars[flag];
+        }
+    }
+
+    if (width > 0){
+        position += string_from_i64(width, position, STRING_INT_SIZE);
+    }
+
+    if (precision >= 0){
+        *position++ = '.';
+        position += string_from_i64(precision, position, STRING_INT_SIZE);
+    }
+
+    if (is_integer(conversion)){
+        *position++ = 'l';
+        *position++ = 'l';
+    }
+
+    *position++ = conversion;
+    *position = '\0';
+}
+
+static bool render_spec(output *o, const fmt_segment *segment, int width, int precision, const fmt_arg *arg){
+    char conversion = segment->conversion;
+    char spec[FMT_SPEC_SIZE];
+    size_t size;
+    char *data = spare(o, &size);
+    int length;
+
+    if (precision < 0 && segment->precisionargument){
+        /* a negative '*' precision counts as none */
+        precision = -1;
+    }
+
+    if (arg->type == FMT_ARG_VIEW){
+        size_t limit = precision >= 0 && (size_t)precision < arg->value.v.length
+            ? (size_t)precision : arg->value.v.length;
+
+        if (limit > INT_MAX){
+            return false;
+        }
+
+        build_spec(segment, width, (int)limit, conversion, spec);
+
+        return put_snprintf_result(o, snprintf(data, size, spec, arg->value.v.data ? arg->value.v.data : ""));
+    }
+    else if ((conversion == 'd' || conversion == 'i') && arg->type == FMT_ARG_UNSIGNED
+            && arg->value.u > INT64_MAX){
+        conversion = 'u';
+    }
+
+    build_spec(segment, width, precision, conversion, spec);
+
+    switch (conversion){
+    case 'd':
+    case 'i':
+        length = snprintf(data, size, spec, (long long)arg->value.i);
+
+        break;
+    case 'c':
+        length = snprintf(data, size, spec, (int)(char)arg->value.i);
+
+        break;
+    case 's':
+        length = snprintf(data, size, spec, arg->value.s);
+
+        break;
+    case 'p':
+        length = snprintf(data, size, spec, arg->value.p);
+
+        break;
+    default:
+        if (is_floating(conversion)){
+            length = snprintf(data, size, spec, arg->value.d);
+        }
+        else {
+            length = snprintf(data, size, spec, (unsigned long long)as_unsigned(arg));
+        }
+    }
+
+    return put_snprintf_result(o, length);
+}
+
+static bool render_typed(const fmt *f, output *o, const fmt_arg *args, size_t count){
+    if (count != f->arguments){
+        return false;
+    }
+
+    const fmt_arg *arg = args;
+
+    for (size_t index = 0; index < f->length; ++index){
+        const fmt_segment *segment = &f->segments[index];
+
+        if (!segment->conversion){
+            put(o, segment->data, segment->length);
+
+            continue;
+        }
+
+        int width = segment->width;
+        int precision = segment->precision;
+
+        if ((segment->widthargument && !star(arg++, &width))
+                || (segment->precisionargument && !star(arg++, &precision))
+                || !fits(arg, segment->conversion)){
+            return false;
+        }
+
+        if (!segment->simple){
+            if (!render_spec(o, segment, width, precision, arg++)){
+                return false;
+            }
+
+            continue;
+        }
+
+        switch (segment->conversion){
+        case 'd':
+        case 'i':
+            if (arg->type == FMT_ARG_SIGNED){
+                put_i64(o, arg->value.i);
+            }
+            else {
+                put_u64(o, arg->value.u);
+            }
+
+            break;
+        case 'u':
+            put_u64(o, as_unsigned(arg));
+
+            break;
+        case 'x':
+        case 'X':
+            put_hex(o, as_unsigned(arg), segment->conversion == 'X');
+
+            break;
+        case 'c':
+            put_char(o, (char)arg->value.i);
+
+            break;
+        case 's':
+            if (arg->type == FMT_ARG_VIEW){
+                put(o, arg->value.v.data, arg->value.v.length);
+            }
+            else {
+                put_string(o, arg->value.s);
+            }
+
+            break;
+        case 'r':
+            put_double(o, arg->value.d);
+
+            break;
+        default:
+            if (!render_spec(o, segment, width, precision, arg)){
+                return false;
+            }
+        }
+
+        arg++;
+    }
+
+    return true;
+}
+
+size_t fmt_vformat(const fmt *f, char *data, size_t size, va_list args){
+    if (!f || (!data && size)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_vformat() - fmt or data is NULL\n",
+            __FILE__
+        );
+
+        return SIZE_MAX;
+    }
+
+    output o = { data, size ? size - 1 : 0, 0 };
+    va_list copy;
+
+    va_copy(copy, args);
+
+    bool success = render_variadic(f, &o, &copy);
+
+    va_end(copy);
+
+    finish(&o, size);
+
+    return success ? o.length : SIZE_MAX;
+}
+
+/* doubles like the strbuf does, so repeated appends stay amortized O(1) */
+static bool grow(strbuf *sb, size_t length){
+    size_t required = sb->length + length + 1;
+    size_t size = sb->size;
+
+    if (required <= sb->length){
+        return false;
+    }
+
+    while (size < required){
+        size = size << 1 > size ? size << 1 : required;
+    }
+
+    return strbuf_reserve(sb, size);
+}
+
+/* one pass into the spare capacity, a second only when it did not fit */
+static bool append_variadic(strbuf *sb, const fmt *f, va_list args){
+    output o = { sb->data + sb->length, sb->size - sb->length - 1, 0 };
+    va_list copy;
+
+    va_copy(copy, args);
+
+    bool success = render_variadic(f, &o, &copy);
+
+    va_end(copy);
+
+    if (success && o.length > o.size){
+        if (!grow(sb, o.length)){
+            sb->data[sb->length] = '\0';
+
+            return false;
+        }
+
+        o = (output){ sb->data + sb->length, sb->size - sb->length - 1, 0 };
+
+        va_copy(copy, args);
+
+        success = render_variadic(f, &o, &copy);
+
+        va_end(copy);
+    }
+
+    if (!success){
+        sb->data[sb->length] = '\0';
+
+        return false;
+    }
+
+    sb->length += o.length;
+    sb->data[sb->length] = '\0';
+
+    return true;
+}
+
+static bool append_typed(strbuf *sb, const fmt *f, const fmt_arg *args, size_t count){
+    output o = { sb->data + sb->length, sb->size - sb->length - 1, 0 };
+    bool success = render_typed(f, &o, args, count);
+
+    if (success && o.length > o.size){
+        if (!grow(sb, o.length)){
+            sb->data[sb->length] = '\0';
+
+            return false;
+        }
+
+        o = (output){ sb->data + sb->length, sb->size - sb->length - 1, 0 };
+        success = render_typed(f, &o, args, count);
+    }
+
+    if (!success){
+        sb->data[sb->length] = '\0';
+
+        return false;
+    }
+
+    sb->length += o.length;
+    sb->data[sb->length] = '\0';
+
+    return true;
+}
+
+bool fmt_vappend(strbuf *sb, const fmt *f, va_list args){
+    if (!sb || !f){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_vappend() - strbuf or fmt is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!append_variadic(sb, f, args)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] fmt_vappend() - formatting failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+bool fmt_append(strbuf *sb, const fmt *f, ...){
+    va_list args;
+
+    va_start(args, f);
+
+    bool success = fmt_vappend(sb, f, args);
+
+    va_end(args);
+
+    return success;
+}
+
+bool fmt_append_args(strbuf *sb, const fmt *f, const fmt_arg *args, size_t count){
+    if (!sb || !f || (!args && count)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_append_args() - strbuf, fmt or args is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!append_typed(sb, f, args, count)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_append_args() - argument count or types do not match the format\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static size_t cache_slot(const char *format){
+    return (size_t)(((uint64_t)(uintptr_t)format * 0x9e3779b97f4a7c15ULL) >> 32) & (FMT_CACHE_SIZE - 1);
+}
+
+/*
+ * variadic formats are only cached once the same address turned
+ * up with the same contents before, so buffers built for a single
+ * call never take a slot. the tag keeps one sighting per bucket,
+ * a collision only costs the next call its admission
+ */
+static bool admit(const char *format){
+    uint64_t tag = xxh3_hash64(format, strlen(format), (uint64_t)(uintptr_t)format) | 1;
+    _Atomic uint64_t *seen = &sightings[tag & (FMT_CACHE_SIZE - 1)];
+
+    if (atomic_load_explicit(seen, memory_order_relaxed) == tag){
+        return true;
+    }
+
+    atomic_store_explicit(seen, tag, memory_order_relaxed);
+
+    return false;
+}
+
+/*
+ * the cached fmt for format, compiling and publishing it on a
+ * miss. entries are never replaced, so when there is no slot (or
+ * the address now holds other contents) variadic callers get NULL
+ * and use vsnprintf. literals can't, so they get a private fmt
+ * the caller frees. NULL as well when the format does not compile
+ */
+static fmt *lookup(const char *format, bool literal, bool *owned){
+    size_t slot = cache_slot(format);
+    bool admitted = literal;
+    fmt *compiled = NULL;
+
+    *owned = false;
+
+    for (size_t index = 0; index < FMT_CACHE_PROBES; ++index){
+        _Atomic(fmt *) *entry = &cache[(slot + index) & (FMT_CACHE_SIZE - 1)];
+        fmt *f = atomic_load_explicit(entry, memory_order_acquire);
+
+        if (!f){
+            if (!admitted && !(admitted = admit(format))){
+                return NULL;
+            }
+            else if (!compiled && !(compiled = compile(format))){
+                return NULL;
+            }
+
+            compiled->key = format;
+
+            if (atomic_compare_exchange_strong_explicit(entry, &f, compiled,
+                    memory_order_acq_rel, memory_order_acquire)){
+                return compiled;
+            }
+        }
+
+        if (f->key == format){
+            if (literal || !strcmp(f->source, format)){
+                if (compiled){
+                    fmt_free(compiled);
+                }
+
+                return f;
+            }
+
+            break;
+        }
+    }
+
+    if (!compiled && literal){
+        compiled = compile(format);
+    }
+
+    *owned = compiled != NULL;
+
+    return compiled;
+}
+
+size_t fmt_vsnprintf(char *data, size_t size, const char *format, va_list args){
+    if (!format || (!data && size)){
+        return SIZE_MAX;
+    }
+
+    bool owned;
+    fmt *f = lookup(format, false, &owned);
+    va_list copy;
+
+    va_copy(copy, args);
+
+    size_t length;
+
+    if (f){
+        output o = { data, size ? size - 1 : 0, 0 };
+
+        length = render_variadic(f, &o, &copy) ? o.length : SIZE_MAX;
+
+        finish(&o, size);
+    }
+    else {
+        int written = vsnprintf(data, size, format, copy);
+
+        length = written < 0 ? SIZE_MAX : (size_t)written;
+    }
+
+    va_end(copy);
+
+    if (owned){
+        fmt_free(f);
+    }
+
+    return length;
+}
+
+bool fmt_vappendf(strbuf *sb, const char *format, va_list args){
+    if (!sb || !format){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_vappendf() - strbuf or format is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    bool owned;
+    fmt *f = lookup(format, false, &owned);
+
+    if (!f){
+        return strbuf_vappendf(sb, format, args);
+    }
+
+    bool success = append_variadic(sb, f, args);
+
+    if (owned){
+        fmt_free(f);
+    }
+
+    if (!success){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] fmt_vappendf() - formatting failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+bool fmt_append_literal(strbuf *sb, const char *format, const fmt_arg *args, size_t count){
+    if (!sb || !format || (!args && count)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_append_literal() - strbuf, format or args is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    bool owned;
+    fmt *f = lookup(format, true, &owned);
+
+    if (!f){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_append_literal() - unsupported format\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    bool success = append_typed(sb, f, args, count);
+
+    if (owned){
+        fmt_free(f);
+    }
+
+    if (!success){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] fmt_append_literal() - argument count or types do not match the format\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+void fmt_cache_clear(void){
+    for (size_t index = 0; index < FMT_CACHE_SIZE; ++index){
+        fmt *f = atomic_exchange_explicit(&cache[index], NULL, memory_order_acq_rel);
+
+        if (f){
+            fmt_free(f);
+        }
+
+        atomic_store_explicit(&sightings[index], 0, memory_order_relaxed);
+    }
+}
+
+void fmt_free(fmt *f){
+    if (!f){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] fmt_free() - fmt is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    free(f->source);
+    free(f->text);
+    free(f->segments);
+    free(f);
+}
@@ -0,0 +1,220 @@
+#ifndef FMT_H
+#define FMT_H
+
+#include "strbuf.h"
+#include "strview.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define FMT_CACHE_SIZE 1024
+#define FMT_CACHE_PROBES 16
+
+/*
+ * printf formats compiled once into a list of literal runs and
+ * conversions. the plain conversions (d i u x X c s without
+ * flags, width or precision) are written with the string_from_*
+ * writers and the rest go through snprintf one conversion at a
+ * time, so the output matches printf either way.
+ *
+ * %r is an extension printing a double with the shortest digits
+ * that round trip (see string_from_double) and takes no flags,
+ * width or precision. positional arguments and %n are rejected
+ */
+typedef enum fmt_modifier {
+    FMT_MODIFIER_NONE,
+    FMT_MODIFIER_CHAR,
+    FMT_MODIFIER_SHORT,
+    FMT_MODIFIER_LONG,
+    FMT_MODIFIER_LONG_LONG,
+    FMT_MODIFIER_INTMAX,
+    FMT_MODIFIER_SIZE,
+    FMT_MODIFIER_PTRDIFF,
+    FMT_MODIFIER_LONG_DOUBLE
+} fmt_modifier;
+
+/*
+ * conversion is 0 for literal text, otherwise data is the NUL
+ * terminated conversion spec. width and precision are -1 when
+ * absent (or taken from an argument)
+ */
+typedef struct fmt_segment {
+    const char *data;
+    size_t length;
+    char conversion;
+    fmt_modifier modifier;
+    uint8_t flags;
+    int width;
+    int precision;
+    bool widthargument;
+    bool precisionargument;
+    bool simple;
+} fmt_segment;
+
+typedef struct fmt {
+    const char *key;
+    char *source;
+    char *text;
+    fmt_segment *segments;
+    size_t length;
+    size_t arguments;
+} fmt;
+
+fmt *fmt_compile(const char *);
+
+/* arguments consumed, '*' widths and precisions included */
+size_t fmt_get_arguments(const fmt *);
+
+/*
+ * snprintf semantics -- the full length is returned even when
+ * the output is truncated (SIZE_MAX on failure)
+ */
+size_t fmt_vformat(const fmt *, char *, size_t, va_list);
+bool fmt_vappend(strbuf *, const fmt *, va_list);
+bool fmt_append(strbuf *, const fmt *, ...);
+
+/*
+ * drop-in vsnprintf / strbuf_vappendf that look the format up
+ * in a process wide cache keyed by its address (the contents
+ * are compared too, so reused buffers are safe). a format is
+ * cached the second time its address shows up with the same
+ * contents, until then -- and when the cache has no room or
+ * the format does not compile -- it goes through vsnprintf.
+ * fmt_vsnprintf never logs, log_write formats through it
+ */
+size_t fmt_vsnprintf(char *, size_t, const char *, va_list);
+bool fmt_vappendf(strbuf *, const char *, va_list);
+
+/* not thread safe -- for shutdown, after the last format call */
+void fmt_cache_clear(void);
+
+void fmt_free(fmt *);
+
+/*
+ * type checked arguments. the conversion chooses the notation
+ * and the argument's own type its value, so there are no length
+ * modifiers to get wrong -- a conversion that does not suit its
+ * argument (or a wrong argument count) fails at render time
+ */
+typedef enum fmt_arg_type {
+    FMT_ARG_SIGNED,
+    FMT_ARG_UNSIGNED,
+    FMT_ARG_DOUBLE,
+    FMT_ARG_STRING,
+    FMT_ARG_VIEW,
+    FMT_ARG_POINTER
+} fmt_arg_type;
+
+typedef struct fmt_arg {
+    fmt_arg_type type;
+    size_t size;
+
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+        const char *s;
+        string_view v;
+        const void *p;
+    } value;
+} fmt_arg;
+
+static inline fmt_arg fmt_arg_signed(int64_t value, size_t size){
+    return (fmt_arg){ .type = FMT_ARG_SIGNED, .size = size, .value.i = value };
+}
+
+static inline fmt_arg fmt_arg_unsigned(uint64_t value, size_t size){
+    return (fmt_arg){ .type = FMT_ARG_UNSIGNED, .size = size, .value.u = value };
+}
+
+static inline fmt_arg fmt_arg_double(double value, size_t size){
+    return (fmt_arg){ .type = FMT_ARG_DOUBLE, .size = size, .value.d = value };
+}
+
+static inline fmt_arg fmt_arg_string(const char *value, size_t size){
+    return (fmt_arg){ .type = FMT_ARG_STRING, .size = size, .value.s = value };
+}
+
+static inline fmt_arg fmt_arg_view(string_view value, size_t size){
+    return (fmt_arg){ .type = FMT_ARG_VIEW, .size = size, .value.v = value };
+}
+
+static inline fmt_arg fmt_arg_pointer(const void *value, size_t size){
+    return (fmt_arg){ .type = FMT_ARG_POINTER, .size = size, .value.p = value };
+}
+
+/* anything without an entry has to convert to a pointer or it does not compile */
+#define FMT_ARG(x) _Generic((x), \
+    _Bool: fmt_arg_unsigned, \
+    char: fmt_arg_signed, \
+    signed char: fmt_arg_signed, \
+    unsigned char: fmt_arg_unsigned, \
+    short: fmt_arg_signed, \
+    unsigned short: fmt_arg_unsigned, \
+    int: fmt_arg_signed, \
+    unsigned int: fmt_arg_unsigned, \
+    long: fmt_arg_signed, \
+    unsigned long: fmt_arg_unsigned, \
+    long long: fmt_arg_signed, \
+    unsigned long long: fmt_arg_unsigned, \
+    float: fmt_arg_double, \
+    double: fmt_arg_double, \
+    char *: fmt_arg_string, \
+    const char *: fmt_arg_string, \
+    string_view: fmt_arg_view, \
+    default: fmt_arg_pointer \
+)((x), sizeof(x))
+
+bool fmt_append_args(strbuf *, const fmt *, const fmt_arg *, size_t);
+
+/* the format MUST be a string literal -- it is cached by address alone */
+bool fmt_append_literal(strbuf *, const char *, const fmt_arg *, size_t);
+
+/*
+ * FMT_APPEND(sb, "literal format", args...) with up to 12
+ * arguments. the "" around the format rejects anything but
+ * a literal at compile time
+ */
+#define FMT_COUNT(...) FMT_COUNT_(__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, _)
+#define FMT_COUNT_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, n, ...) n
+
+#define FMT_CONCAT(a, b) FMT_CONCAT_(a, b)
+#define FMT_CONCAT_(a, b) a##b
+
+#define FMT_APPEND(sb, ...) FMT_CONCAT(FMT_APPEND_, FMT_COUNT(__VA_ARGS__))(sb, __VA_ARGS__)
+
+#define FMT_LIST(sb, format, count, ...) \
+    fmt_append_literal((sb), "" format "", (const fmt_arg []){ __VA_ARGS__ }, (count))
+
+#define FMT_APPEND_0(sb, format) fmt_append_literal((sb), "" format "", NULL, 0)
+#define FMT_APPEND_1(sb, format, a) FMT_LIST(sb, format, 1, FMT_ARG(a))
+#define FMT_APPEND_2(sb, format, a, b) FMT_LIST(sb, format, 2, FMT_ARG(a), FMT_ARG(b))
+#define FMT_APPEND_3(sb, format, a, b, c) FMT_LIST(sb, format, 3, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c))
+#define FMT_APPEND_4(sb, format, a, b, c, d) \
+    FMT_LIST(sb, format, 4, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d))
+#define FMT_APPEND_5(sb, format, a, b, c, d, e) \
+    FMT_LIST(sb, format, 5, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e))
+#define FMT_APPEND_6(sb, format, a, b, c, d, e, f) \
+    FMT_LIST(sb, format, 6, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f))
+#define FMT_APPEND_7(sb, format, a, b, c, d, e, f, g) \
+    FMT_LIST(sb, format, 7, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f), \
+        FMT_ARG(g))
+#define FMT_APPEND_8(sb, format, a, b, c, d, e, f, g, h) \
+    FMT_LIST(sb, format, 8, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f), \
+        FMT_ARG(g), FMT_ARG(h))
+#define FMT_APPEND_9(sb, format, a, b, c, d, e, f, g, h, i) \
+    FMT_LIST(sb, format, 9, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f), \
+        FMT_ARG(g), FMT_ARG(h), FMT_ARG(i))
+#define FMT_APPEND_10(sb, format, a, b, c, d, e, f, g, h, i, j) \
+    FMT_LIST(sb, format, 10, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f), \
+        FMT_ARG(g), FMT_ARG(h), FMT_ARG(i), FMT_ARG(j))
+#define FMT_APPEND_11(sb, format, a, b, c, d, e, f, g, h, i, j, k) \
+    FMT_LIST(sb, format, 11, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f), \
+        FMT_ARG(g), FMT_ARG(h), FMT_ARG(i), FMT_ARG(j), FMT_ARG(k))
+#define FMT_APPEND_12(sb, format, a, b, c, d, e, f, g, h, i, j, k, l) \
+    FMT_LIST(sb, format, 12, FMT_ARG(a), FMT_ARG(b), FMT_ARG(c), FMT_ARG(d), FMT_ARG(e), FMT_ARG(f), \
+        FMT_ARG(g), FMT_ARG(h), FMT_ARG(i), FMT_ARG(j), FMT_ARG(k), FMT_ARG(l))
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef CRC32C_H
+#define CRC32C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * CRC-32C (Castagnoli, as in iSCSI, ext4 and SCTP) for integrity
+ * checks. on CPUs with SSE4.2 it runs on the crc32 instruction,
+ * three independent streams at a time over long buffers, and
+ * otherwise on slicing-by-8 tables. results are the standard
+ * ones -- crc32c("123456789") is 0xe3069283
+ */
+uint32_t crc32c(const void *, size_t);
+
+/*
+ * streaming -- start from 0 and pass each result back in with
+ * the next piece of data, the final result is crc32c of it all
+ */
+uint32_t crc32c_update(uint32_t, const void *, size_t);
+
+/* crc32c of A followed by B, from crc32c(A), crc32c(B) and B's length */
+uint32_t crc32c_combine(uint32_t, uint32_t, size_t);
+
+#endif
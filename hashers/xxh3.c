@@ -0,0 +1,796 @@
+#include "xxh3.h"
+
+#include "cpu.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#endif
+
+#define PRIME32_1 0x9e3779b1U
+#define PRIME32_2 0x85ebca77U
+#define PRIME32_3 0xc2b2ae3dU
+
+#define PRIME64_1 0x9e3779b185ebca87ULL
+#define PRIME64_2 0xc2b2ae3d27d4eb4fULL
+#define PRIME64_3 0x165667b19e3779f9ULL
+#define PRIME64_4 0x85ebca77c2b2ae63ULL
+#define PRIME64_5 0x27d4eb2f165667c5ULL
+
+#define PRIME_MX1 0x165667919e3779f9ULL
+#define PRIME_MX2 0x9fb21c651e98df25ULL
+
+#define SECRET_SIZE 192
+#define SECRET_SIZE_MIN 136
+#define STRIPE_LENGTH 64
+#define SECRET_CONSUME_RATE 8
+#define ACCUMULATORS 8
+#define MIDSIZE_MAX 240
+#define MIDSIZE_START_OFFSET 3
+#define MIDSIZE_LAST_OFFSET 17
+#define SECRET_LAST_ACCUMULATE_START 7
+#define SECRET_MERGE_START 11
+
+#define STRIPES_PER_BLOCK ((SECRET_SIZE - STRIPE_LENGTH) / SECRET_CONSUME_RATE)
+#define BLOCK_LENGTH (STRIPE_LENGTH * STRIPES_PER_BLOCK)
+
+typedef struct xxh3_u128 {
+    uint64_t low;
+    uint64_t high;
+} xxh3_u128;
+
+static const uint8_t default_secret[SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+/* little endian loads, like the rest of hashers/ */
+static uint32_t read32(const uint8_t *data){
+    uint32_t value;
+
+    memcpy(&value, data, sizeof(value));
+
+    return value;
+}
+
+static uint64_t read64(const uint8_t *data){
+    uint64_t value;
+
+    memcpy(&value, data, sizeof(value));
+
+    return value;
+}
+
+static void write64(uint8_t *data, uint64_t value){
+    memcpy(data, &value, sizeof(value));
+}
+
+static uint64_t rotl64(uint64_t value, unsigned shift){
+    return (value << shift) | (value >> (64 - shift));
+}
+
+static uint32_t rotl32(uint32_t value, unsigned shift){
+    return (value << shift) | (value >> (32 - shift));
+}
+
+static xxh3_u128 multiply(uint64_t a, uint64_t b){
+    xxh3_u128 result;
+
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+
+    u128 product = (u128)a * b;
+
+    result.low = (uint64_t)product;
+    result.high = (uint64_t)(product >> 64);
+#else
+    uint64_t lolo = (a & 0xffffffff) * (b & 0xffffffff);
+    uint64_t hilo = (a >> 32) * (b & 0xffffffff);
+    uint64_t lohi = (a & 0xffffffff) * (b >> 32);
+    uint64_t hihi = (a >> 32) * (b >> 32);
+    uint64_t cross = (lolo >> 32) + (hilo & 0xffffffff) + lohi;
+
+    result.high = (hilo >> 32) + (cross >> 32) + hihi;
+    result.low = (cross << 32) | (lolo & 0xffffffff);
+#endif
+
+    return result;
+}
+
+static uint64_t multiply_fold(uint64_t a, uint64_t b){
+    xxh3_u128 product = multiply(a, b);
+
+    return product.low ^ product.high;
+}
+
+static uint64_t xxh64_avalanche(uint64_t hash){
+    hash ^= hash >> 33;
+    hash *= PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= PRIME64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+static uint64_t avalanche(uint64_t hash){
+    hash ^= hash >> 37;
+    hash *= PRIME_MX1;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+static uint64_t rrmxmx(uint64_t hash, uint64_t length){
+    hash ^= rotl64(hash, 49) ^ rotl64(hash, 24);
+    hash *= PRIME_MX2;
+    hash ^= (hash >> 35) + length;
+    hash *= PRIME_MX2;
+
+    return hash ^ (hash >> 28);
+}
+
+static uint64_t mix16(const uint8_t *input, const uint8_t *secret, uint64_t seed){
+    return multiply_fold(
+        read64(input) ^ (read64(secret) + seed),
+        read64(input + 8) ^ (read64(secret + 8) - seed)
+    );
+}
+
+static xxh3_u128 mix32(xxh3_u128 acc, const uint8_t *first, const uint8_t *second, const uint8_t *secret, uint64_t seed){
+    acc.low += mix16(first, secret, seed);
+    acc.low ^= read64(second) + read64(second + 8);
+    acc.high += mix16(second, secret + 16, seed);
+    acc.high ^= read64(first) + read64(first + 8);
+
+    return acc;
+}
+
+/* ---------------- the stripe accumulator (inputs over 240 bytes) ---------------- */
+
+static void accumulate_scalar(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes){
+    for (size_t stripe = 0; stripe < stripes; ++stripe){
+        const uint8_t *in = input + stripe * STRIPE_LENGTH;
+        const uint8_t *key = secret + stripe * SECRET_CONSUME_RATE;
+
+        for (size_t lane = 0; lane < ACCUMULATORS; ++lane){
+            uint64_t data = read64(in + 8 * lane);
+            uint64_t keyed = data ^ read64(key + 8 * lane);
+
+            acc[lane ^ 1] += data;
+            acc[lane] += (keyed & 0xffffffff) * (keyed >> 32);
+        }
+    }
+}
+
+static void scramble_scalar(uint64_t *acc, const uint8_t *secret){
+    for (size_t lane = 0; lane < ACCUMULATORS; ++lane){
+        uint64_t a = acc[lane];
+
+        a ^= a >> 47;
+        a ^= read64(secret + 8 * lane);
+        a *= PRIME32_1;
+
+        acc[lane] = a;
+    }
+}
+
+#ifdef CPU_X86
+__attribute__((target("sse2")))
+static void accumulate_sse2(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes){
+    __m128i *vectors = (__m128i *)acc;
+    __m128i a[4];
+
+    for (size_t lane = 0; lane < 4; ++lane){
+        a[lane] = _mm_load_si128(vectors + lane);
+    }
+
+    for (size_t stripe = 0; stripe < stripes; ++stripe){
+        const uint8_t *in = input + stripe * STRIPE_LENGTH;
+        const uint8_t *key = secret + stripe * SECRET_CONSUME_RATE;
+
+        for (size_t lane = 0; lane < 4; ++lane){
+            __m128i d = _mm_loadu_si128((const __m128i *)(in + 16 * lane));
+            __m128i k = _mm_xor_si128(d, _mm_loadu_si128((const __m128i *)(key + 16 * lane)));
+            __m128i p = _mm_mul_epu32(k, _mm_shuffle_epi32(k, _MM_SHUFFLE(0, 3, 0, 1)));
+
+            a[lane] = _mm_add_epi64(a[lane], _mm_add_epi64(p, _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+    }
+
+    for (size_t lane = 0; lane < 4; ++lane){
+        _mm_store_si128(vectors + lane, a[lane]);
+    }
+}
+
+__attribute__((target("sse2")))
+static void scramble_sse2(uint64_t *acc, const uint8_t *secret){
+    __m128i *vectors = (__m128i *)acc;
+    __m128i prime = _mm_set1_epi32((int)PRIME32_1);
+
+    for (size_t lane = 0; lane < 4; ++lane){
+        __m128i a = _mm_load_si128(vectors + lane);
+        __m128i k = _mm_loadu_si128((const __m128i *)(secret + 16 * lane));
+
+        a = _mm_xor_si128(_mm_xor_si128(a, _mm_srli_epi64(a, 47)), k);
+
+        __m128i low = _mm_mul_epu32(a, prime);
+        __m128i high = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+
+        _mm_store_si128(vectors + lane, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+    }
+}
+
+__attribute__((target("avx2")))
+static void accumulate_avx2(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes){
+    __m256i *vectors = (__m256i *)acc;
+    __m256i a0 = _mm256_load_si256(vectors);
+    __m256i a1 = _mm256_load_si256(vectors + 1);
+
+    for (size_t stripe = 0; stripe < stripes; ++stripe){
+        const uint8_t *in = input + stripe * STRIPE_LENGTH;
+        const uint8_t *key = secret + stripe * SECRET_CONSUME_RATE;
+
+        __m256i d0 = _mm256_loadu_si256((const __m256i *)in);
+        __m256i d1 = _mm256_loadu_si256((const __m256i *)(in + 32));
+        __m256i k0 = _mm256_xor_si256(d0, _mm256_loadu_si256((const __m256i *)key));
+        __m256i k1 = _mm256_xor_si256(d1, _mm256_loadu_si256((const __m256i *)(key + 32)));
+
+        /* low half times high half of each keyed lane, plus the neighbouring lane's data */
+        __m256i p0 = _mm256_mul_epu32(k0, _mm256_shuffle_epi32(k0, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m256i p1 = _mm256_mul_epu32(k1, _mm256_shuffle_epi32(k1, _MM_SHUFFLE(0, 3, 0, 1)));
+
+        a0 = _mm256_add_epi64(a0, _mm256_add_epi64(p0, _mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2))));
+        a1 = _mm256_add_epi64(a1, _mm256_add_epi64(p1, _mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    _mm256_store_si256(vectors, a0);
+    _mm256_store_si256(vectors + 1, a1);
+}
+
+__attribute__((target("avx2")))
+static void scramble_avx2(uint64_t *acc, const uint8_t *secret){
+    __m256i *vectors = (__m256i *)acc;
+    __m256i prime = _mm256_set1_epi32((int)PRIME32_1);
+
+    for (size_t lane = 0; lane < 2; ++lane){
+        __m256i a = _mm256_load_si256(vectors + lane);
+        __m256i k = _mm256_loadu_si256((const __m256i *)(secret + 32 * lane));
+
+        a = _mm256_xor_si256(_mm256_xor_si256(a, _mm256_srli_epi64(a, 47)), k);
+
+        __m256i low = _mm256_mul_epu32(a, prime);
+        __m256i high = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+
+        _mm256_store_si256(vectors + lane, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+    }
+}
+
+__attribute__((target("avx512f")))
+static void accumulate_avx512(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes){
+    __m512i a = _mm512_loadu_si512(acc);
+
+    for (size_t stripe = 0; stripe < stripes; ++stripe){
+        const uint8_t *in = input + stripe * STRIPE_LENGTH;
+        __m512i d = _mm512_loadu_si512(in);
+        __m512i k = _mm512_xor_si512(d, _mm512_loadu_si512(secret + stripe * SECRET_CONSUME_RATE));
+
+        /* one register holds the whole stripe */
+        a = _mm512_add_epi64(a, _mm512_add_epi64(
+            _mm512_mul_epu32(k, _mm512_srli_epi64(k, 32)),
+            _mm512_shuffle_epi32(d, (_MM_PERM_ENUM)_MM_SHUFFLE(1, 0, 3, 2))
+        ));
+    }
+
+    _mm512_storeu_si512(acc, a);
+}
+
+__attribute__((target("avx512f")))
+static void scramble_avx512(uint64_t *acc, const uint8_t *secret){
+    __m512i prime = _mm512_set1_epi32((int)PRIME32_1);
+    __m512i a = _mm512_loadu_si512(acc);
+
+    a = _mm512_xor_si512(_mm512_xor_si512(a, _mm512_srli_epi64(a, 47)), _mm512_loadu_si512(secret));
+
+    __m512i low = _mm512_mul_epu32(a, prime);
+    __m512i high = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), prime);
+
+    _mm512_storeu_si512(acc, _mm512_add_epi64(low, _mm512_slli_epi64(high, 32)));
+}
+#endif
+
+/* stripe kernels and the batch hasher for what the CPU can run, see get_kernels */
+typedef struct xxh3_kernels {
+    void (*accumulate)(uint64_t *, const uint8_t *, const uint8_t *, size_t);
+    void (*scramble)(uint64_t *, const uint8_t *);
+    void (*batch)(const void *const *, const size_t *, size_t, uint64_t, uint64_t *);
+} xxh3_kernels;
+
+static const xxh3_kernels *get_kernels(void);
+
+static void hash_long(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t *acc){
+    const xxh3_kernels *kernels = get_kernels();
+    size_t blocks = (length - 1) / BLOCK_LENGTH;
+
+    acc[0] = PRIME32_3;
+    acc[1] = PRIME64_1;
+    acc[2] = PRIME64_2;
+    acc[3] = PRIME64_3;
+    acc[4] = PRIME64_4;
+    acc[5] = PRIME32_2;
+    acc[6] = PRIME64_5;
+    acc[7] = PRIME32_1;
+
+    for (size_t block = 0; block < blocks; ++block){
+        kernels->accumulate(acc, input + block * BLOCK_LENGTH, secret, STRIPES_PER_BLOCK);
+        kernels->scramble(acc, secret + SECRET_SIZE - STRIPE_LENGTH);
+    }
+
+    /* what is left of the last block, then its final (possibly overlapping) stripe */
+    size_t stripes = ((length - 1) - BLOCK_LENGTH * blocks) / STRIPE_LENGTH;
+
+    kernels->accumulate(acc, input + blocks * BLOCK_LENGTH, secret, stripes);
+    kernels->accumulate(
+        acc,
+        input + length - STRIPE_LENGTH,
+        secret + SECRET_SIZE - STRIPE_LENGTH - SECRET_LAST_ACCUMULATE_START,
+        1
+    );
+}
+
+static uint64_t merge(const uint64_t *acc, const uint8_t *secret, uint64_t start){
+    uint64_t result = start;
+
+    for (size_t lane = 0; lane < 4; ++lane){
+        result += multiply_fold(
+            acc[2 * lane] ^ read64(secret + 16 * lane),
+            acc[2 * lane + 1] ^ read64(secret + 16 * lane + 8)
+        );
+    }
+
+    return avalanche(result);
+}
+
+/* a seeded long hash uses the default secret shifted by the seed */
+static const uint8_t *long_secret(uint64_t seed, uint8_t *custom){
+    if (!seed){
+        return default_secret;
+    }
+
+    for (size_t pos = 0; pos < SECRET_SIZE; pos += 16){
+        write64(custom + pos, read64(default_secret + pos) + seed);
+        write64(custom + pos + 8, read64(default_secret + pos + 8) - seed);
+    }
+
+    return custom;
+}
+
+/* ---------------- 64 bit ---------------- */
+
+static uint64_t hash64_short(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed){
+    if (length > 8){
+        uint64_t low = read64(input) ^ ((read64(secret + 24) ^ read64(secret + 32)) + seed);
+        uint64_t high = read64(input + length - 8) ^ ((read64(secret + 40) ^ read64(secret + 48)) - seed);
+        uint64_t acc = length + __builtin_bswap64(low) + high + multiply_fold(low, high);
+
+        return avalanche(acc);
+    }
+    else if (length >= 4){
+        seed ^= (uint64_t)__builtin_bswap32((uint32_t)seed) << 32;
+
+        uint64_t combined = read32(input + length - 4) + ((uint64_t)read32(input) << 32);
+        uint64_t flip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+
+        return rrmxmx(combined ^ flip, length);
+    }
+    else if (length){
+        uint32_t combined = ((uint32_t)input[0] << 16) | ((uint32_t)input[length >> 1] << 24)
+            | input[length - 1] | ((uint32_t)length << 8);
+        uint64_t flip = (read32(secret) ^ read32(secret + 4)) + seed;
+
+        return xxh64_avalanche(combined ^ flip);
+    }
+
+    return xxh64_avalanche(seed ^ read64(secret + 56) ^ read64(secret + 64));
+}
+
+static uint64_t hash64_medium(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed){
+    uint64_t acc = length * PRIME64_1;
+
+    if (length > 128){
+        size_t rounds = length / 16;
+
+        for (size_t chunk = 0; chunk < 8; ++chunk){
+            acc += mix16(input + 16 * chunk, secret + 16 * chunk, seed);
+        }
+
+        acc = avalanche(acc);
+
+        for (size_t chunk = 8; chunk < rounds; ++chunk){
+            acc += mix16(input + 16 * chunk, secret + 16 * (chunk - 8) + MIDSIZE_START_OFFSET, seed);
+        }
+
+        acc += mix16(input + length - 16, secret + SECRET_SIZE_MIN - MIDSIZE_LAST_OFFSET, seed);
+
+        return avalanche(acc);
+    }
+
+    if (length > 32){
+        if (length > 64){
+            if (length > 96){
+                acc += mix16(input + 48, secret + 96, seed);
+                acc += mix16(input + length - 64, secret + 112, seed);
+            }
+
+            acc += mix16(input + 32, secret + 64, seed);
+            acc += mix16(input + length - 48, secret + 80, seed);
+        }
+
+        acc += mix16(input + 16, secret + 32, seed);
+        acc += mix16(input + length - 32, secret + 48, seed);
+    }
+
+    acc += mix16(input, secret, seed);
+    acc += mix16(input + length - 16, secret + 16, seed);
+
+    return avalanche(acc);
+}
+
+uint64_t xxh3_hash64(const void *data, size_t length, uint64_t seed){
+    const uint8_t *input = data;
+
+    if (length <= 16){
+        return hash64_short(input, length, default_secret, seed);
+    }
+    else if (length <= MIDSIZE_MAX){
+        return hash64_medium(input, length, default_secret, seed);
+    }
+
+    _Alignas(32) uint64_t acc[ACCUMULATORS];
+    uint8_t custom[SECRET_SIZE];
+    const uint8_t *secret = long_secret(seed, custom);
+
+    hash_long(input, length, secret, acc);
+
+    return merge(acc, secret + SECRET_MERGE_START, length * PRIME64_1);
+}
+
+/* ---------------- 64 bit, many keys per call ---------------- */
+
+static void batch_scalar(const void *const *keys, const size_t *lengths, size_t count, uint64_t seed, uint64_t *hashes){
+    for (size_t index = 0; index < count; ++index){
+        hashes[index] = xxh3_hash64(keys[index], lengths[index], seed);
+    }
+}
+
+#ifdef CPU_X86
+#define BATCH_LANES 4
+
+/* low 64 bits of a * b per lane -- AVX2 only multiplies 32 bit halves */
+__attribute__((target("avx2")))
+static __m256i lanes_multiply(__m256i a, __m256i b){
+    __m256i cross = _mm256_mullo_epi32(a, _mm256_shuffle_epi32(b, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m256i high = _mm256_slli_epi64(_mm256_add_epi32(cross, _mm256_srli_epi64(cross, 32)), 32);
+
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), high);
+}
+
+/* multiply_fold per lane */
+__attribute__((target("avx2")))
+static __m256i lanes_multiply_fold(__m256i a, __m256i b){
+    __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i ahigh = _mm256_srli_epi64(a, 32);
+    __m256i bhigh = _mm256_srli_epi64(b, 32);
+    __m256i lolo = _mm256_mul_epu32(a, b);
+    __m256i hilo = _mm256_mul_epu32(ahigh, b);
+    __m256i lohi = _mm256_mul_epu32(a, bhigh);
+    __m256i hihi = _mm256_mul_epu32(ahigh, bhigh);
+    __m256i cross = _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_srli_epi64(lolo, 32), _mm256_and_si256(hilo, mask)),
+        lohi
+    );
+    __m256i high = _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_srli_epi64(hilo, 32), _mm256_srli_epi64(cross, 32)),
+        hihi
+    );
+    __m256i low = _mm256_or_si256(_mm256_slli_epi64(cross, 32), _mm256_and_si256(lolo, mask));
+
+    return _mm256_xor_si256(low, high);
+}
+
+__attribute__((target("avx2")))
+static __m256i lanes_rotl(__m256i value, int shift){
+    return _mm256_or_si256(_mm256_slli_epi64(value, shift), _mm256_srli_epi64(value, 64 - shift));
+}
+
+/* hash64_short for four keys of 4-8 bytes */
+__attribute__((target("avx2")))
+static __m256i lanes_4to8(const uint8_t *const *input, const size_t *length, uint64_t seed){
+    __m256i combined = _mm256_set_epi64x(
+        (long long)(read32(input[3] + length[3] - 4) + ((uint64_t)read32(input[3]) << 32)),
+        (long long)(read32(input[2] + length[2] - 4) + ((uint64_t)read32(input[2]) << 32)),
+        (long long)(read32(input[1] + length[1] - 4) + ((uint64_t)read32(input[1]) << 32)),
+        (long long)(read32(input[0] + length[0] - 4) + ((uint64_t)read32(input[0]) << 32))
+    );
+    __m256i sizes = _mm256_set_epi64x(
+        (long long)length[3], (long long)length[2], (long long)length[1], (long long)length[0]
+    );
+
+    seed ^= (uint64_t)__builtin_bswap32((uint32_t)seed) << 32;
+
+    __m256i prime = _mm256_set1_epi64x((long long)PRIME_MX2);
+    __m256i h = _mm256_xor_si256(
+        combined,
+        _mm256_set1_epi64x((long long)((read64(default_secret + 8) ^ read64(default_secret + 16)) - seed))
+    );
+
+    h = _mm256_xor_si256(h, _mm256_xor_si256(lanes_rotl(h, 49), lanes_rotl(h, 24)));
+    h = lanes_multiply(h, prime);
+    h = _mm256_xor_si256(h, _mm256_add_epi64(_mm256_srli_epi64(h, 35), sizes));
+    h = lanes_multiply(h, prime);
+
+    return _mm256_xor_si256(h, _mm256_srli_epi64(h, 28));
+}
+
+/* hash64_short for four keys of 9-16 bytes */
+__attribute__((target("avx2")))
+static __m256i lanes_9to16(const uint8_t *const *input, const size_t *length, uint64_t seed){
+    __m256i first = _mm256_set_epi64x(
+        (long long)read64(input[3]), (long long)read64(input[2]),
+        (long long)read64(input[1]), (long long)read64(input[0])
+    );
+    __m256i last = _mm256_set_epi64x(
+        (long long)read64(input[3] + length[3] - 8), (long long)read64(input[2] + length[2] - 8),
+        (long long)read64(input[1] + length[1] - 8), (long long)read64(input[0] + length[0] - 8)
+    );
+    __m256i sizes = _mm256_set_epi64x(
+        (long long)length[3], (long long)length[2], (long long)length[1], (long long)length[0]
+    );
+    __m256i bswap = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+    );
+    __m256i low = _mm256_xor_si256(
+        first,
+        _mm256_set1_epi64x((long long)((read64(default_secret + 24) ^ read64(default_secret + 32)) + seed))
+    );
+    __m256i high = _mm256_xor_si256(
+        last,
+        _mm256_set1_epi64x((long long)((read64(default_secret + 40) ^ read64(default_secret + 48)) - seed))
+    );
+    __m256i acc = _mm256_add_epi64(
+        _mm256_add_epi64(sizes, _mm256_shuffle_epi8(low, bswap)),
+        _mm256_add_epi64(high, lanes_multiply_fold(low, high))
+    );
+
+    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 37));
+    acc = lanes_multiply(acc, _mm256_set1_epi64x((long long)PRIME_MX1));
+
+    return _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 32));
+}
+
+/*
+ * runs of four keys from the same size class share the vector
+ * lanes, anything else is hashed one key at a time
+ */
+__attribute__((target("avx2")))
+static void batch_avx2(const void *const *keys, const size_t *lengths, size_t count, uint64_t seed, uint64_t *hashes){
+    size_t index = 0;
+
+    while (index + BATCH_LANES <= count){
+        const uint8_t *const *input = (const uint8_t *const *)(keys + index);
+        const size_t *length = lengths + index;
+
+        /* unsigned wrap turns each range check into one compare */
+        bool small = length[0] - 4 <= 4 && length[1] - 4 <= 4 && length[2] - 4 <= 4 && length[3] - 4 <= 4;
+        bool medium = length[0] - 9 <= 7 && length[1] - 9 <= 7 && length[2] - 9 <= 7 && length[3] - 9 <= 7;
+
+        if (small){
+            _mm256_storeu_si256((__m256i *)(hashes + index), lanes_4to8(input, length, seed));
+
+            index += BATCH_LANES;
+        }
+        else if (medium){
+            _mm256_storeu_si256((__m256i *)(hashes + index), lanes_9to16(input, length, seed));
+
+            index += BATCH_LANES;
+        }
+        else {
+            hashes[index] = xxh3_hash64(keys[index], lengths[index], seed);
+
+            ++index;
+        }
+    }
+
+    for (; index < count; ++index){
+        hashes[index] = xxh3_hash64(keys[index], lengths[index], seed);
+    }
+}
+#endif
+
+static const xxh3_kernels scalar_kernels = { accumulate_scalar, scramble_scalar, batch_scalar };
+
+#ifdef CPU_X86
+static const xxh3_kernels sse2_kernels = { accumulate_sse2, scramble_sse2, batch_scalar };
+static const xxh3_kernels avx2_kernels = { accumulate_avx2, scramble_avx2, batch_avx2 };
+static const xxh3_kernels avx512_kernels = { accumulate_avx512, scramble_avx512, batch_avx2 };
+#endif
+
+/* picked on first use -- every thread that races here picks the same table */
+static const xxh3_kernels *_Atomic kernels = NULL;
+
+static const xxh3_kernels *get_kernels(void){
+    const xxh3_kernels *current = atomic_load_explicit(&kernels, memory_order_acquire);
+
+    if (current){
+        return current;
+    }
+
+    current = &scalar_kernels;
+
+#ifdef CPU_X86
+    if (cpu_has(CPU_FEATURE_AVX512)){
+        current = &avx512_kernels;
+    }
+    else if (cpu_has(CPU_FEATURE_AVX2)){
+        current = &avx2_kernels;
+    }
+    else if (cpu_has(CPU_FEATURE_SSE2)){
+        current = &sse2_kernels;
+    }
+#endif
+
+    atomic_store_explicit(&kernels, current, memory_order_release);
+
+    return current;
+}
+
+void xxh3_hash64_batch(const void *const *keys, const size_t *lengths, size_t count, uint64_t seed, uint64_t *hashes){
+    get_kernels()->batch(keys, lengths, count, seed, hashes);
+}
+
+/* ---------------- 128 bit ---------------- */
+
+static xxh3_u128 hash128_short(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed){
+    xxh3_u128 result;
+
+    if (length > 8){
+        uint64_t flip_low = (read64(secret + 32) ^ read64(secret + 40)) - seed;
+        uint64_t flip_high = (read64(secret + 48) ^ read64(secret + 56)) + seed;
+        uint64_t low = read64(input);
+        uint64_t high = read64(input + length - 8);
+        xxh3_u128 m = multiply(low ^ high ^ flip_low, PRIME64_1);
+
+        m.low += (uint64_t)(length - 1) << 54;
+        high ^= flip_high;
+        m.high += high + (uint64_t)(uint32_t)high * (PRIME32_2 - 1);
+        m.low ^= __builtin_bswap64(m.high);
+
+        result = multiply(m.low, PRIME64_2);
+        result.high += m.high * PRIME64_2;
+        result.low = avalanche(result.low);
+        result.high = avalanche(result.high);
+    }
+    else if (length >= 4){
+        seed ^= (uint64_t)__builtin_bswap32((uint32_t)seed) << 32;
+
+        uint64_t combined = read32(input) + ((uint64_t)read32(input + length - 4) << 32);
+        uint64_t flip = (read64(secret + 16) ^ read64(secret + 24)) + seed;
+
+        result = multiply(combined ^ flip, PRIME64_1 + (length << 2));
+        result.high += result.low << 1;
+        result.low ^= result.high >> 3;
+        result.low ^= result.low >> 35;
+        result.low *= PRIME_MX2;
+        result.low ^= result.low >> 28;
+        result.high = avalanche(result.high);
+    }
+    else if (length){
+        uint32_t combined_low = ((uint32_t)input[0] << 16) | ((uint32_t)input[length >> 1] << 24)
+            | input[length - 1] | ((uint32_t)length << 8);
+        uint32_t combined_high = rotl32(__builtin_bswap32(combined_low), 13);
+        uint64_t flip_low = (read32(secret) ^ read32(secret + 4)) + seed;
+        uint64_t flip_high = (read32(secret + 8) ^ read32(secret + 12)) - seed;
+
+        result.low = xxh64_avalanche(combined_low ^ flip_low);
+        result.high = xxh64_avalanche(combined_high ^ flip_high);
+    }
+    else {
+        result.low = xxh64_avalanche(seed ^ read64(secret + 64) ^ read64(secret + 72));
+        result.high = xxh64_avalanche(seed ^ read64(secret + 80) ^ read64(secret + 88));
+    }
+
+    return result;
+}
+
+static xxh3_u128 hash128_medium(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed){
+    xxh3_u128 acc = { length * PRIME64_1, 0 };
+
+    if (length > 128){
+        size_t rounds = length / 32;
+
+        for (size_t chunk = 0; chunk < 4; ++chunk){
+            acc = mix32(acc, input + 32 * chunk, input + 32 * chunk + 16, secret + 32 * chunk, seed);
+        }
+
+        acc.low = avalanche(acc.low);
+        acc.high = avalanche(acc.high);
+
+        for (size_t chunk = 4; chunk < rounds; ++chunk){
+            acc = mix32(acc, input + 32 * chunk, input + 32 * chunk + 16,
+                secret + MIDSIZE_START_OFFSET + 32 * (chunk - 4), seed);
+        }
+
+        acc = mix32(acc, input + length - 16, input + length - 32,
+            secret + SECRET_SIZE_MIN - MIDSIZE_LAST_OFFSET - 16, 0 - seed);
+    }
+    else {
+        if (length > 32){
+            if (length > 64){
+                if (length > 96){
+                    acc = mix32(acc, input + 48, input + length - 64, secret + 96, seed);
+                }
+
+                acc = mix32(acc, input + 32, input + length - 48, secret + 64, seed);
+            }
+
+            acc = mix32(acc, input + 16, input + length - 32, secret + 32, seed);
+        }
+
+        acc = mix32(acc, input, input + length - 16, secret, seed);
+    }
+
+    xxh3_u128 result;
+
+    result.low = avalanche(acc.low + acc.high);
+    result.high = 0 - avalanche(acc.low * PRIME64_1 + acc.high * PRIME64_4 + (length - seed) * PRIME64_2);
+
+    return result;
+}
+
+void xxh3_hash128(const void *data, size_t length, uint64_t seed, uint64_t *low, uint64_t *high){
+    const uint8_t *input = data;
+    xxh3_u128 result;
+
+    if (length <= 16){
+        result = hash128_short(input, length, default_secret, seed);
+    }
+    else if (length <= MIDSIZE_MAX){
+        result = hash128_medium(input, length, default_secret, seed);
+    }
+    else {
+        _Alignas(32) uint64_t acc[ACCUMULATORS];
+        uint8_t custom[SECRET_SIZE];
+        const uint8_t *secret = long_secret(seed, custom);
+
+        hash_long(input, length, secret, acc);
+
+        result.low = merge(acc, secret + SECRET_MERGE_START, length * PRIME64_1);
+        result.high = merge(
+            acc,
+            secret + SECRET_SIZE - STRIPE_LENGTH - SECRET_MERGE_START,
+            ~(length * PRIME64_2)
+        );
+    }
+
+    if (low){
+        *low = result.low;
+    }
+
+    if (high){
+        *high = result.high;
+    }
+}
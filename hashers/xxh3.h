@@ -0,0 +1,26 @@
+#ifndef XXH3_H
+#define XXH3_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * XXH3 (xxHash 0.8 family), 64 and 128 bit, seeded -- the
+ * outputs match the reference XXH3_64bits_withSeed and
+ * XXH3_128bits_withSeed. inputs up to 16 bytes take one or two
+ * multiplies, 17-240 bytes a handful of 16 byte mixes and longer
+ * ones run the stripe accumulator with SSE2, AVX2 or AVX-512,
+ * whichever the CPU has (see cpu.h)
+ */
+uint64_t xxh3_hash64(const void *, size_t, uint64_t);
+/* the two out pointers get the low then the high 64 bits */
+void xxh3_hash128(const void *, size_t, uint64_t, uint64_t *, uint64_t *);
+
+/*
+ * xxh3_hash64 of each key (pointers and lengths side by side)
+ * into the output array. on AVX2 CPUs, runs of 4-8 and 9-16
+ * byte keys are hashed four at a time across vector lanes
+ */
+void xxh3_hash64_batch(const void *const *, const size_t *, size_t, uint64_t, uint64_t *);
+
+#endif
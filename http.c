@@ -18,40 +18,22 @@ static size_t write_response_headers(char *data, size_t size, size_t nitems, voi
     size *= nitems;
     map *m = out;
 
-    list *parts = string_split_len(data, size, ": ", 1);
-
-    if (!parts){
-        log_write(
-            logger,
-            LOG_ERROR,
-            "[%s] write_response_headers() - string_split_len call failed\n",
-            __FILE__
-        );
-
-        return 0;
-    }
-    else if (list_get_length(parts) != 2){
-        list_free(parts);
-
+    /* header lines are not NUL terminated -- only views are used */
+    str_tok tok;
+    string_view key;
+    string_view value;
+
+    /* a line without the separator (status line, blank line) yields one token */
+    if (!str_tok_init(&tok, string_view_init(data, size), string_view_init(": ", 2), 1)
+            || !str_tok_next(&tok, &key) || !str_tok_next(&tok, &value)){
         return size;
     }
 
-    const char *keystr = list_get_string(parts, 0);
-    const char *valuestr = list_get_string(parts, 1);
-
-    map_item key = {0};
-    key.type = M_TYPE_STRING;
-    key.size = strlen(keystr);
-    key.data_copy = keystr;
-
-    map_item value = {0};
-    value.type = M_TYPE_STRING;
-    value.size = strlen(valuestr) - 2;
-    value.data_copy = valuestr;
-
-    bool success = map_set(m, &key, &value);
+    while (value.length && (value.data[value.length - 1] == '\n' || value.data[value.length - 1] == '\r')){
+        --value.length;
+    }
 
-    list_free(parts);
+    bool success = map_set_view(m, key, value);
 
     if (!success){
         log_write(
@@ -752,6 +734,9 @@ http_response *http_request(http_client *http, http_method method, const char *p
         return NULL;
     }
 
+    /* header names are case-insensitive -- fold them when hashing and comparing */
+    map_set_hasher(responseheaders, string_hash_casefold, string_equal_casefold);
+
     if (!set_response_header_writer(handle, responseheaders)){
         log_write(
             logger,
@@ -0,0 +1,406 @@
+#include "intern.h"
+
+#include "log.h"
+
+#include "hashers/spooky.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INTERN_SEED 0x9e3779b97f4a7c15ULL
+#define INTERN_ALIGNMENT (sizeof(atom_header))
+
+static logctx *logger = NULL;
+
+static intern global;
+static pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* every block starts with a pointer to the one before it */
+typedef struct block_link {
+    char *previous;
+} block_link;
+
+static const atom_header *header(atom a){
+    return (const atom_header *)a - 1;
+}
+
+static size_t aligned(size_t size){
+    return (size + INTERN_ALIGNMENT - 1) & ~(INTERN_ALIGNMENT - 1);
+}
+
+static bool table_init(intern *in){
+    in->slots = calloc(INTERN_MINIMUM_SIZE, sizeof(*in->slots));
+
+    if (!in->slots){
+        return false;
+    }
+
+    in->size = INTERN_MINIMUM_SIZE;
+    in->length = 0;
+    in->block = NULL;
+    in->blockused = 0;
+    in->blocksize = 0;
+
+    return true;
+}
+
+static size_t find_slot(const intern *in, const char *data, size_t length, uint64_t hash){
+    size_t mask = in->size - 1;
+    size_t index = (size_t)hash & mask;
+
+    for (;;){
+        atom a = in->slots[index];
+
+        if (!a){
+            return index;
+        }
+
+        const atom_header *h = header(a);
+
+        if (h->hash == hash && h->length == length && !memcmp(a, data, length)){
+            return index;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static bool grow(intern *in){
+    size_t size = in->size << 1;
+    atom *slots = size > in->size ? calloc(size, sizeof(*slots)) : NULL;
+
+    if (!slots){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] grow() - slots alloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    for (size_t count = 0; count < in->size; ++count){
+        atom a = in->slots[count];
+
+        if (a){
+            size_t index = (size_t)header(a)->hash & (size - 1);
+
+            while (slots[index]){
+                index = (index + 1) & (size - 1);
+            }
+
+            slots[index] = a;
+        }
+    }
+
+    free(in->slots);
+
+    in->slots = slots;
+    in->size = size;
+
+    return true;
+}
+
+/*
+ * room for a header and string. long strings get a block to
+ * themselves, linked in behind the current one so it keeps
+ * being filled
+ */
+static atom_header *allocate(intern *in, size_t length){
+    size_t needed = aligned(sizeof(atom_header) + length + 1);
+    size_t start = aligned(sizeof(block_link));
+
+    if (needed > (INTERN_BLOCK_SIZE - start) / 4){
+        char *block = malloc(start + needed);
+
+        if (!block){
+            return NULL;
+        }
+
+        block_link *link = (block_link *)block;
+
+        if (in->block){
+            block_link *current = (block_link *)in->block;
+
+            link->previous = current->previous;
+            current->previous = block;
+        }
+        else {
+            /* no current block yet, the dedicated one becomes it (full) */
+            link->previous = NULL;
+            in->block = block;
+            in->blockused = start + needed;
+            in->blocksize = start + needed;
+        }
+
+        return (atom_header *)(block + start);
+    }
+
+    if (!in->block || in->blockused + needed > in->blocksize){
+        char *block = malloc(INTERN_BLOCK_SIZE);
+
+        if (!block){
+            return NULL;
+        }
+
+        ((block_link *)block)->previous = in->block;
+
+        in->block = block;
+        in->blockused = start;
+        in->blocksize = INTERN_BLOCK_SIZE;
+    }
+
+    atom_header *h = (atom_header *)(in->block + in->blockused);
+
+    in->blockused += needed;
+
+    return h;
+}
+
+static void table_free(intern *in){
+    char *block = in->block;
+
+    while (block){
+        char *previous = ((block_link *)block)->previous;
+
+        free(block);
+
+        block = previous;
+    }
+
+    free(in->slots);
+
+    in->slots = NULL;
+    in->size = 0;
+    in->length = 0;
+    in->block = NULL;
+}
+
+static atom insert(intern *in, const char *data, size_t length){
+    uint64_t hash = spooky_hash64(data, length, INTERN_SEED);
+    size_t index = find_slot(in, data, length, hash);
+
+    if (in->slots[index]){
+        return in->slots[index];
+    }
+
+    /* keep the load at or under a half */
+    if ((in->length + 1) * 2 > in->size){
+        if (!grow(in)){
+            return NULL;
+        }
+
+        index = find_slot(in, data, length, hash);
+    }
+
+    atom_header *h = allocate(in, length);
+
+    if (!h){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] insert() - atom alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    char *string = (char *)(h + 1);
+
+    h->hash = hash;
+    h->length = length;
+
+    memcpy(string, data, length);
+
+    string[length] = '\0';
+
+    in->slots[index] = string;
+    in->length++;
+
+    return string;
+}
+
+intern *intern_init(void){
+    intern *in = malloc(sizeof(*in));
+
+    if (!in){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] intern_init() - intern alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    if (!table_init(in)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] intern_init() - slots alloc failed\n",
+            __FILE__
+        );
+
+        free(in);
+
+        return NULL;
+    }
+
+    return in;
+}
+
+atom intern_string(intern *in, const char *data, size_t length){
+    if (!in || (!data && length)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] intern_string() - intern or data is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    return insert(in, data ? data : "", length);
+}
+
+atom intern_find(const intern *in, const char *data, size_t length){
+    if (!in || (!data && length)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] intern_find() - intern or data is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+    else if (!in->slots){
+        return NULL;
+    }
+
+    data = data ? data : "";
+
+    return in->slots[find_slot(in, data, length, spooky_hash64(data, length, INTERN_SEED))];
+}
+
+size_t intern_get_length(const intern *in){
+    if (!in){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] intern_get_length() - intern is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return in->length;
+}
+
+void intern_free(intern *in){
+    if (!in){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] intern_free() - intern is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    table_free(in);
+
+    free(in);
+}
+
+atom string_intern(const char *data, size_t length){
+    if (!data && length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] string_intern() - data is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    pthread_mutex_lock(&global_lock);
+
+    atom a = NULL;
+
+    if (global.slots || table_init(&global)){
+        a = insert(&global, data ? data : "", length);
+    }
+
+    pthread_mutex_unlock(&global_lock);
+
+    if (!a){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] string_intern() - insert failed\n",
+            __FILE__
+        );
+    }
+
+    return a;
+}
+
+void string_intern_clear(void){
+    pthread_mutex_lock(&global_lock);
+
+    table_free(&global);
+
+    pthread_mutex_unlock(&global_lock);
+}
+
+size_t atom_get_length(atom a){
+    if (!a){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] atom_get_length() - atom is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return header(a)->length;
+}
+
+uint64_t atom_get_hash(atom a){
+    if (!a){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] atom_get_hash() - atom is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return header(a)->hash;
+}
+
+uint64_t atom_hasher(const void *data, size_t size, uint64_t seed){
+    (void)size;
+
+    return header(data)->hash ^ seed;
+}
+
+bool atom_key_equal(const void *a, size_t asize, const void *b, size_t bsize){
+    (void)asize;
+    (void)bsize;
+
+    return a == b;
+}
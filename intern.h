@@ -0,0 +1,69 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define INTERN_MINIMUM_SIZE 64
+#define INTERN_BLOCK_SIZE 16384
+
+/*
+ * an interned string -- one copy per distinct string, NUL
+ * terminated and stable until its table is freed, so atoms
+ * from the same table are equal exactly when their pointers
+ * are. the length and hash are stored just before the string
+ */
+typedef const char *atom;
+
+typedef struct atom_header {
+    uint64_t hash;
+    size_t length;
+} atom_header;
+
+/*
+ * open addressed table of atoms whose strings are packed into
+ * INTERN_BLOCK_SIZE blocks (longer strings get one of their
+ * own), so interning allocates next to nothing per string.
+ * not thread safe -- string_intern is
+ */
+typedef struct intern {
+    atom *slots;
+    size_t size;
+    size_t length;
+
+    char *block;
+    size_t blockused;
+    size_t blocksize;
+} intern;
+
+intern *intern_init(void);
+
+/* the atom for the string, added when missing (NULL on failure) */
+atom intern_string(intern *, const char *, size_t);
+
+/* NULL when the string was never interned */
+atom intern_find(const intern *, const char *, size_t);
+
+size_t intern_get_length(const intern *);
+
+void intern_free(intern *);
+
+/* process wide table, safe from any thread */
+atom string_intern(const char *, size_t);
+
+/* not thread safe -- for shutdown, every atom it handed out is freed */
+void string_intern_clear(void);
+
+size_t atom_get_length(atom);
+uint64_t atom_get_hash(atom);
+
+/*
+ * usable as a map_hasher / map_key_equal pair when every key
+ * set (as M_TYPE_ATOM) and looked up is an atom from the same
+ * table -- hashing is a load and comparison a pointer compare
+ */
+uint64_t atom_hasher(const void *, size_t, uint64_t);
+bool atom_key_equal(const void *, size_t, const void *, size_t);
+
+#endif
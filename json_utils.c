@@ -3,6 +3,7 @@
 #include "list.h"
 #include "log.h"
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -230,7 +231,10 @@ json_object *list_to_json_array(const list *l){
 
             break;
         case L_TYPE_STRING:
-            obj = json_object_new_string(list_get_string(l, index));
+            obj = json_object_new_string_len(
+                list_get_string(l, index),
+                list_get_item_size(l, index)
+            );
 
             break;
         default:
@@ -384,7 +388,7 @@ map *json_to_map(json_object *json){
             strvalue = json_object_get_string(valueobj);
 
             v.type = M_TYPE_STRING;
-            v.size = strlen(strvalue);
+            v.size = json_object_get_string_len(valueobj);
             v.data_copy = strvalue;
 
             break;
@@ -455,6 +459,74 @@ json_object *map_to_json(const map *m){
     return json;
 }
 
+string_view json_to_string_view(json_object *json){
+    string_view view = {0};
+
+    if (!json){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] json_to_string_view() - json is NULL\n",
+            __FILE__
+        );
+
+        return view;
+    }
+    else if (json_object_get_type(json) != json_type_string){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] json_to_string_view() - json is *not* a string\n",
+            __FILE__
+        );
+
+        return view;
+    }
+
+    view.data = json_object_get_string(json);
+    view.length = json_object_get_string_len(json);
+
+    return view;
+}
+
+json_object *string_view_to_json(string_view view){
+    if (!view.data){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] string_view_to_json() - view is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+    else if (view.length > INT_MAX){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] string_view_to_json() - view is too long for json-c\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    json_object *json = json_object_new_string_len(view.data, view.length);
+
+    if (!json){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] string_view_to_json() - json string initialization failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    return json;
+}
+
 bool json_merge_objects(json_object *from, json_object *into){
     if (!from || !into){
         log_write(
@@ -3,6 +3,7 @@
 
 #include "list.h"
 #include "map.h"
+#include "strview.h"
 
 #include <json-c/json.h>
 
@@ -12,6 +13,10 @@ json_object *list_to_json_array(const list *);
 map *json_to_map(json_object *);
 json_object *map_to_json(const map *);
 
+/* the view points into the json object and lives as long as it */
+string_view json_to_string_view(json_object *);
+json_object *string_view_to_json(string_view);
+
 bool json_merge_objects(json_object *, json_object *);
 
 #endif
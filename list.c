@@ -1,10 +1,18 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "list.h"
 
 #include "log.h"
+#include "pool.h"
 #include "str.h"
 
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #define LIST_MINIMUM_SIZE 8
 
@@ -14,6 +22,91 @@
 #define LIST_SHRINK_LOAD_FACTOR 0.25
 #define LIST_SHRINK_FACTOR 0.5
 
+#define LIST_SORT_INSERTION_THRESHOLD 16
+#define LIST_SORT_RADIX_MINIMUM 64
+#define LIST_SORT_PARALLEL_MINIMUM 65536
+
+#define LIST_PARALLEL_CHUNKS_PER_THREAD 4
+#define LIST_PARALLEL_MINIMUM_CHUNK 1024
+
+/* per chunk accumulators get a line each so workers don't share one */
+#define LIST_CACHE_LINE 64
+
+/* bulk appends carve their items out of slabs this big */
+#define LIST_SLAB_SIZE (64 * 1024)
+/* what live starts at so items freed mid carve can't empty it */
+#define LIST_SLAB_CARVING (SIZE_MAX / 2)
+
+#define LIST_RADIX_BITS 8
+#define LIST_RADIX_BUCKETS (1 << LIST_RADIX_BITS)
+#define LIST_RADIX_PASSES (64 / LIST_RADIX_BITS)
+
+/*
+ * the extend calls carve many items out of one slab instead
+ * of a malloc each -- live counts the items still in use once
+ * the extend call retires the slab and the last one out frees
+ * it, so a single surviving item pins all of it
+ */
+typedef struct itemslab {
+    atomic_size_t live;
+    size_t carved;
+    size_t used;
+    size_t size;
+    max_align_t data[];
+} itemslab;
+
+/*
+ * every item is allocated behind a reference count so
+ * slices can share items -- the last owner frees it
+ */
+typedef struct itemnode {
+    size_t refs;
+    itemslab *slab;
+    list_item item;
+} itemnode;
+
+typedef struct sortkey {
+    uint64_t key;
+    list_item *item;
+} sortkey;
+
+typedef struct sorttask {
+    list_item **items;
+    list_item **tmp;
+    size_t length;
+    ltype type;
+    list_compare cmp;
+    bool success;
+} sorttask;
+
+typedef struct paralleltask {
+    const list *l;
+    size_t chunks;
+    void *ctx;
+
+    list_for_fn forfn;
+    list_map_fn mapfn;
+    list_filter_fn filterfn;
+    list_reduce_fn reducefn;
+
+    list_item **out;
+    list_item ***kept;
+    size_t *keptlen;
+    unsigned char *accs;
+    size_t accstride;
+
+    bool *failed;
+} paralleltask;
+
+typedef struct mergetask {
+    list_item **src;
+    list_item **dst;
+    size_t low;
+    size_t mid;
+    size_t high;
+    list_compare cmp;
+} mergetask;
+
 static logctx *logger = NULL;
 
 static size_t calculate_new_size(size_t s){
@@ -39,10 +132,86 @@ static bool check_availability(list *l){
     return true;
 }
 
+static itemnode *get_node(list_item *i){
+    return (itemnode *)((char *)i - offsetof(itemnode, item));
+}
+
+static void slab_release(itemslab *s, size_t count){
+    if (atomic_fetch_sub_explicit(&s->live, count, memory_order_acq_rel) == count){
+        free(s);
+    }
+}
+
+static void slab_retire(itemslab *s){
+    /* trade the carving bias for the items actually carved */
+    if (s){
+        slab_release(s, LIST_SLAB_CARVING - s->carved);
+    }
+}
+
+static itemnode *node_alloc(itemslab **slab, size_t remaining, size_t payload){
+    size_t align = alignof(max_align_t);
+    size_t size = (sizeof(itemnode) + payload + align - 1) & ~(align - 1);
+
+    if (!slab || size > LIST_SLAB_SIZE / 4){
+        itemnode *n = malloc(sizeof(*n) + payload);
+
+        if (n){
+            n->slab = NULL;
+        }
+
+        return n;
+    }
+
+    itemslab *s = *slab;
+
+    if (!s || s->size - s->used < size){
+        /* sized for what is still to come, up to a full slab */
+        size_t capacity = LIST_SLAB_SIZE;
+
+        if (remaining < capacity / size){
+            capacity = (remaining ? remaining : 1) * size;
+        }
+
+        s = malloc(sizeof(*s) + capacity);
+
+        if (!s){
+            return NULL;
+        }
+
+        atomic_init(&s->live, LIST_SLAB_CARVING);
+        s->carved = 0;
+        s->used = 0;
+        s->size = capacity;
+
+        slab_retire(*slab);
+
+        *slab = s;
+    }
+
+    itemnode *n = (itemnode *)((unsigned char *)s->data + s->used);
+
+    s->used += size;
+    s->carved++;
+
+    n->slab = s;
+
+    return n;
+}
+
+static void node_free(itemnode *n){
+    if (n->slab){
+        slab_release(n->slab, 1);
+    }
+    else {
+        free(n);
+    }
+}
+
 static list_item *item_init_pointer(ltype type, size_t size, void *data, list_generic_free generic_free){
-    list_item *i = malloc(sizeof(*i));
+    itemnode *n = malloc(sizeof(*n));
 
-    if (!i){
+    if (!n){
         log_write(
             logger,
             LOG_ERROR,
@@ -53,6 +222,11 @@ static list_item *item_init_pointer(ltype type, size_t size, void *data, list_ge
         return NULL;
     }
 
+    n->refs = 1;
+    n->slab = NULL;
+
+    list_item *i = &n->item;
+
     i->type = type;
     i->size = size;
     i->data = data;
@@ -61,20 +235,52 @@ static list_item *item_init_pointer(ltype type, size_t size, void *data, list_ge
     return i;
 }
 
-static list_item *item_init(ltype type, size_t size, const void *data, list_generic_free generic_free){
-    list_item *i = malloc(sizeof(*i));
+static bool is_inline_type(ltype type){
+    return type != L_TYPE_GENERIC
+        && type != L_TYPE_LIST
+        && type != L_TYPE_MAP
+        && type != L_TYPE_NULL;
+}
 
-    if (!i){
+static void *item_inline_data(list_item *i){
+    return i + 1;
+}
+
+/*
+ * with a slab the node is carved from it, remaining being how many
+ * items the caller still has to create, otherwise it is malloc'd
+ */
+static list_item *item_carve(itemslab **slab, size_t remaining, ltype type, size_t size, const void *data, list_generic_free generic_free){
+    /*
+     * scalar and string payloads are stored directly after
+     * the item so a single allocation covers both
+     */
+    size_t payload = 0;
+
+    if (type == L_TYPE_STRING){
+        payload = size + 1;
+    }
+    else if (is_inline_type(type)){
+        payload = size;
+    }
+
+    itemnode *n = node_alloc(slab, remaining, payload);
+
+    if (!n){
         log_write(
             logger,
             LOG_ERROR,
-            "[%s] item_init() - item object alloc failed\n",
+            "[%s] item_carve() - item object alloc failed\n",
             __FILE__
         );
 
         return NULL;
     }
 
+    n->refs = 1;
+
+    list_item *i = &n->item;
+
     i->type = type;
     i->size = size;
     i->generic_free = generic_free;
@@ -86,11 +292,11 @@ static list_item *item_init(ltype type, size_t size, const void *data, list_gene
             log_write(
                 logger,
                 LOG_ERROR,
-                "[%s] item_init() - list_copy call failed\n",
+                "[%s] item_carve() - list_copy call failed\n",
                 __FILE__
             );
 
-            free(i);
+            node_free(n);
 
             return NULL;
         }
@@ -102,11 +308,11 @@ static list_item *item_init(ltype type, size_t size, const void *data, list_gene
             log_write(
                 logger,
                 LOG_ERROR,
-                "[%s] item_init() - map_copy call failed\n",
+                "[%s] item_carve() - map_copy call failed\n",
                 __FILE__
             );
 
-            free(i);
+            node_free(n);
 
             return NULL;
         }
@@ -115,45 +321,43 @@ static list_item *item_init(ltype type, size_t size, const void *data, list_gene
         i->data = NULL;
     }
     else if (type == L_TYPE_STRING){
-        i->data = malloc(size + 1);
-
-        if (!i->data){
-            log_write(
-                logger,
-                LOG_ERROR,
-                "[%s] item_init() - item string alloc failed\n",
-                __FILE__
-            );
+        i->data = item_inline_data(i);
 
-            free(i);
-
-            return NULL;
-        }
+        memcpy(i->data, data, size);
 
-        string_copy(data, i->data, size);
+        ((char *)i->data)[size] = '\0';
     }
-    else {
+    else if (type == L_TYPE_GENERIC){
         i->data = malloc(size);
 
         if (!i->data){
             log_write(
                 logger,
                 LOG_ERROR,
-                "[%s] item_init() - item data alloc failed\n",
+                "[%s] item_carve() - item data alloc failed\n",
                 __FILE__
             );
 
-            free(i);
+            node_free(n);
 
             return NULL;
         }
 
         memcpy(i->data, data, size);
     }
+    else {
+        i->data = item_inline_data(i);
+
+        memcpy(i->data, data, size);
+    }
 
     return i;
 }
 
+static list_item *item_init(ltype type, size_t size, const void *data, list_generic_free generic_free){
+    return item_carve(NULL, 0, type, size, data, generic_free);
+}
+
 static void item_free(list_item *i){
     if (!i){
         log_write(
@@ -166,6 +370,13 @@ static void item_free(list_item *i){
         return;
     }
 
+    itemnode *n = get_node(i);
+
+    if (--n->refs){
+        /* still shared with a slice */
+        return;
+    }
+
     switch (i->type){
     case L_TYPE_GENERIC:
         if (i->generic_free){
@@ -187,10 +398,99 @@ static void item_free(list_item *i){
     case L_TYPE_NULL:
         break;
     default:
-        free(i->data);
+        if (i->data != item_inline_data(i)){
+            free(i->data);
+        }
+    }
+
+    node_free(n);
+}
+
+static bool item_take_data(list_item *i, void **data){
+    if (!i->data){
+        *data = NULL;
+
+        return true;
+    }
+
+    if (get_node(i)->refs == 1 && i->data != item_inline_data(i)){
+        *data = i->data;
+
+        i->type = L_TYPE_NULL;
+        i->size = 0;
+        i->data = NULL;
+        i->generic_free = NULL;
+
+        return true;
+    }
+
+    /* an opaque payload can't be copied safely, its inner pointers would be freed twice */
+    if (i->type == L_TYPE_GENERIC){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] item_take_data() - generic data is shared with a slice\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    /* shared and inline payloads stay with the item -- hand out a copy */
+    void *copy = NULL;
+
+    if (i->type == L_TYPE_LIST){
+        copy = list_copy(i->data);
+    }
+    else if (i->type == L_TYPE_MAP){
+        copy = map_copy(i->data);
+    }
+    else {
+        size_t datasize = i->type == L_TYPE_STRING ? i->size + 1 : i->size;
+
+        copy = malloc(datasize);
+
+        if (copy){
+            memcpy(copy, i->data, datasize);
+        }
+    }
+
+    if (!copy){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] item_take_data() - data copy failed\n",
+            __FILE__
+        );
+
+        return false;
     }
 
-    free(i);
+    *data = copy;
+
+    return true;
+}
+
+static bool check_writable(const list *l, const char *caller){
+    if (l->view){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] %s() - list is a read-only view\n",
+            __FILE__,
+            caller
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static void truncate_items(list *l, size_t length){
+    while (l->length > length){
+        item_free(l->items[--l->length]);
+    }
 }
 
 static list_item *get_item(const list *l, size_t pos, ltype type){
@@ -237,320 +537,1509 @@ static list_item *get_item(const list *l, size_t pos, ltype type){
     return i;
 }
 
-list *list_init(void){
-    if (LIST_MINIMUM_SIZE <= 0){
-        log_write(
-            logger,
-            LOG_ERROR,
-            "[%s] list_init() - LIST_MINIMUM_SIZE must be greater than 0\n",
-            __FILE__
-        );
+static const void *item_data(const list_item *i){
+    return i->data ? i->data : i->data_copy;
+}
 
-        return NULL;
+static int compare_default(const list_item *a, const list_item *b){
+    if (a->type != b->type){
+        return a->type < b->type ? -1 : 1;
     }
 
-    list *l = calloc(1, sizeof(*l));
-
-    if (!l){
-        log_write(
-            logger,
-            LOG_ERROR,
-            "[%s] list_init() - list object alloc failed\n",
-            __FILE__
-        );
+    const void *adata = item_data(a);
+    const void *bdata = item_data(b);
 
-        return NULL;
-    }
+    switch (a->type){
+    case L_TYPE_BOOL:
+        return *(const bool *)adata - *(const bool *)bdata;
+    case L_TYPE_CHAR:
+        return *(const char *)adata - *(const char *)bdata;
+    case L_TYPE_DOUBLE: {
+        double x = *(const double *)adata;
+        double y = *(const double *)bdata;
 
-    l->length = 0;
-    l->size = LIST_MINIMUM_SIZE;
-    l->items = calloc(l->size, sizeof(*l->items));
+        /* NaN sorts after everything else */
+        if (x != x || y != y){
+            return (x != x) - (y != y);
+        }
 
-    if (!l->items){
-        log_write(
-            logger,
-            LOG_ERROR,
-            "[%s] list_init() - items object alloc failed\n",
-            __FILE__
-        );
+        return (x > y) - (x < y);
+    }
+    case L_TYPE_INT: {
+        int64_t x = *(const int64_t *)adata;
+        int64_t y = *(const int64_t *)bdata;
 
-        free(l);
+        return (x > y) - (x < y);
+    }
+    case L_TYPE_UINT: {
+        uint64_t x = *(const uint64_t *)adata;
+        uint64_t y = *(const uint64_t *)bdata;
 
-        return NULL;
+        return (x > y) - (x < y);
     }
+    case L_TYPE_SIZE_T: {
+        size_t x = *(const size_t *)adata;
+        size_t y = *(const size_t *)bdata;
 
-    return l;
-}
+        return (x > y) - (x < y);
+    }
+    case L_TYPE_STRING: {
+        size_t length = a->size < b->size ? a->size : b->size;
+        int result = memcmp(adata, bdata, length);
 
-list *list_copy(const list *l){
-    if (!l){
-        log_write(
-            logger,
-            LOG_WARNING,
-            "[%s] list_copy() - list is NULL\n",
-            __FILE__
-        );
+        if (result){
+            return result;
+        }
 
-        return NULL;
+        return (a->size > b->size) - (a->size < b->size);
     }
+    default:
+        /* lists, maps, generics and nulls keep their relative order */
+        return 0;
+    }
+}
 
-    list *copy = list_init();
-
-    if (!copy){
-        log_write(
-            logger,
-            LOG_ERROR,
-            "[%s] list_copy() - list initialization failed\n",
-            __FILE__
-        );
+static bool is_radix_type(ltype type){
+    return type == L_TYPE_INT || type == L_TYPE_UINT || type == L_TYPE_SIZE_T;
+}
 
-        return NULL;
+static ltype get_sort_type(const list *l, list_compare cmp){
+    if (cmp || !l->length){
+        return L_TYPE_RESERVED_EMPTY;
     }
 
-    for (size_t index = 0; index < l->length; ++index){
-        const list_item *i = get_item(l, index, L_TYPE_RESERVED_EMPTY);
+    ltype type = l->items[0]->type;
 
-        if (!list_append(copy, i)){
-            log_write(
-                logger,
-                LOG_ERROR,
-                "[%s] list_copy() - list_append call failed\n",
-                __FILE__
-            );
+    for (size_t index = 1; index < l->length; ++index){
+        if (l->items[index]->type != type){
+            return L_TYPE_RESERVED_EMPTY;
+        }
+    }
 
-            list_free(copy);
+    return type;
+}
 
-            return NULL;
-        }
+static uint64_t get_radix_key(const list_item *i, ltype type){
+    if (type == L_TYPE_INT){
+        /* flip the sign bit so negative values order first */
+        return (uint64_t)*(const int64_t *)i->data ^ ((uint64_t)1 << 63);
+    }
+    else if (type == L_TYPE_SIZE_T){
+        return *(const size_t *)i->data;
     }
 
-    return copy;
+    return *(const uint64_t *)i->data;
 }
 
-bool list_resize(list *l, size_t size){
-    if (!l){
+static bool radix_sort(list_item **items, size_t length, ltype type){
+    sortkey *keys = malloc(2 * length * sizeof(*keys));
+
+    if (!keys){
         log_write(
             logger,
-            LOG_WARNING,
-            "[%s] list_resize() - list is NULL\n",
+            LOG_ERROR,
+            "[%s] radix_sort() - keys alloc failed\n",
             __FILE__
         );
 
         return false;
     }
-    else if (size == 0 || size < LIST_MINIMUM_SIZE){
-        log_write(
-            logger,
-            LOG_WARNING,
-            "[%s] list_resize() - size cannot be 0 or less than LIST_MINIMUM_SIZE -- set to LIST_MINIMUM_SIZE (%d)\n",
-            __FILE__,
-            LIST_MINIMUM_SIZE
-        );
-
-        size = LIST_MINIMUM_SIZE;
-    }
 
-    if (size < l->length){
-        for (size_t index = size; index < l->length; ++index){
-            item_free(l->items[index]);
-        }
-
-        l->length = size;
-    }
-
-    list_item **items = realloc(l->items, size * sizeof(*items));
+    size_t (*counts)[LIST_RADIX_BUCKETS] = calloc(
+        LIST_RADIX_PASSES,
+        sizeof(*counts)
+    );
 
-    if (!items){
+    if (!counts){
         log_write(
             logger,
             LOG_ERROR,
-            "[%s] list_resize() - items object realloc failed\n",
+            "[%s] radix_sort() - counts alloc failed\n",
             __FILE__
         );
 
+        free(keys);
+
         return false;
     }
 
-    l->items = items;
-    l->size = size;
+    /* one pass builds the histograms for every digit */
+    for (size_t index = 0; index < length; ++index){
+        uint64_t key = get_radix_key(items[index], type);
 
-    return true;
-}
+        keys[index].key = key;
+        keys[index].item = items[index];
+
+        for (size_t pass = 0; pass < LIST_RADIX_PASSES; ++pass){
+            ++counts[pass][(key >> (pass * LIST_RADIX_BITS)) & (LIST_RADIX_BUCKETS - 1)];
+        }
+    }
+
+    sortkey *src = keys;
+    sortkey *dst = keys + length;
+
+    for (size_t pass = 0; pass < LIST_RADIX_PASSES; ++pass){
+        size_t shift = pass * LIST_RADIX_BITS;
+        size_t *count = counts[pass];
+
+        /* every key shares this digit -- nothing would move */
+        if (count[(src[0].key >> shift) & (LIST_RADIX_BUCKETS - 1)] == length){
+            continue;
+        }
+
+        size_t offset = 0;
+
+        for (size_t bucket = 0; bucket < LIST_RADIX_BUCKETS; ++bucket){
+            size_t tmp = count[bucket];
+
+            count[bucket] = offset;
+            offset += tmp;
+        }
+
+        for (size_t index = 0; index < length; ++index){
+            dst[count[(src[index].key >> shift) & (LIST_RADIX_BUCKETS - 1)]++] = src[index];
+        }
+
+        sortkey *tmp = src;
+
+        src = dst;
+        dst = tmp;
+    }
+
+    for (size_t index = 0; index < length; ++index){
+        items[index] = src[index].item;
+    }
+
+    free(counts);
+    free(keys);
+
+    return true;
+}
+
+static void insertion_sort(list_item **items, size_t length, list_compare cmp){
+    for (size_t index = 1; index < length; ++index){
+        list_item *i = items[index];
+        size_t pos = index;
+
+        for (; pos > 0 && cmp(items[pos - 1], i) > 0; --pos){
+            items[pos] = items[pos - 1];
+        }
+
+        items[pos] = i;
+    }
+}
+
+static void merge_runs(list_item **src, list_item **dst, size_t low, size_t mid, size_t high, list_compare cmp){
+    size_t left = low;
+    size_t right = mid;
+    size_t out = low;
+
+    /* runs are already in order */
+    if (left < mid && right < high && cmp(src[mid - 1], src[mid]) <= 0){
+        memcpy(&dst[low], &src[low], (high - low) * sizeof(*dst));
+
+        return;
+    }
+
+    while (left < mid && right < high){
+        if (cmp(src[right], src[left]) < 0){
+            dst[out++] = src[right++];
+        }
+        else {
+            dst[out++] = src[left++];
+        }
+    }
+
+    memcpy(&dst[out], &src[left], (mid - left) * sizeof(*dst));
+
+    out += mid - left;
+
+    memcpy(&dst[out], &src[right], (high - right) * sizeof(*dst));
+}
+
+static void merge_sort(list_item **items, list_item **tmp, size_t length, list_compare cmp){
+    for (size_t start = 0; start < length; start += LIST_SORT_INSERTION_THRESHOLD){
+        size_t runlen = length - start;
+
+        if (runlen > LIST_SORT_INSERTION_THRESHOLD){
+            runlen = LIST_SORT_INSERTION_THRESHOLD;
+        }
+
+        insertion_sort(&items[start], runlen, cmp);
+    }
+
+    list_item **src = items;
+    list_item **dst = tmp;
+
+    for (size_t width = LIST_SORT_INSERTION_THRESHOLD; width < length; width <<= 1){
+        for (size_t low = 0; low < length; low += width << 1){
+            size_t mid = low + width < length ? low + width : length;
+            size_t high = low + (width << 1) < length ? low + (width << 1) : length;
+
+            merge_runs(src, dst, low, mid, high, cmp);
+        }
+
+        list_item **hold = src;
+
+        src = dst;
+        dst = hold;
+    }
+
+    if (src != items){
+        memcpy(items, src, length * sizeof(*items));
+    }
+}
+
+static bool sort_range(list_item **items, list_item **tmp, size_t length, ltype type, list_compare cmp){
+    if (is_radix_type(type) && length >= LIST_SORT_RADIX_MINIMUM){
+        return radix_sort(items, length, type);
+    }
+
+    merge_sort(items, tmp, length, cmp ? cmp : compare_default);
+
+    return true;
+}
+
+static void *sort_worker(void *arg){
+    sorttask *task = arg;
+
+    task->success = sort_range(
+        task->items,
+        task->tmp,
+        task->length,
+        task->type,
+        task->cmp
+    );
+
+    return NULL;
+}
+
+static void *merge_worker(void *arg){
+    mergetask *task = arg;
+
+    merge_runs(
+        task->src,
+        task->dst,
+        task->low,
+        task->mid,
+        task->high,
+        task->cmp
+    );
+
+    return NULL;
+}
+
+static size_t get_chunk_count(threadpool *pool, size_t length){
+    size_t threads = pool ? threadpool_get_size(pool) + 1 : 1;
+    size_t chunks = threads * LIST_PARALLEL_CHUNKS_PER_THREAD;
+    size_t maximum = (length + LIST_PARALLEL_MINIMUM_CHUNK - 1) / LIST_PARALLEL_MINIMUM_CHUNK;
+
+    if (chunks > maximum){
+        chunks = maximum;
+    }
+
+    return chunks ? chunks : 1;
+}
+
+static void get_chunk_bounds(const paralleltask *task, size_t chunk, size_t *low, size_t *high){
+    size_t length = task->l->length;
+    size_t base = length / task->chunks;
+    size_t extra = length % task->chunks;
+
+    *low = base * chunk + (chunk < extra ? chunk : extra);
+    *high = *low + base + (chunk < extra ? 1 : 0);
+}
+
+static bool run_parallel(threadpool *pool, threadpool_task fn, paralleltask *task){
+    if (!pool || task->chunks == 1){
+        for (size_t chunk = 0; chunk < task->chunks; ++chunk){
+            fn(chunk, task);
+        }
+
+        return true;
+    }
+
+    return threadpool_run(pool, task->chunks, fn, task);
+}
+
+static bool check_failed(const paralleltask *task){
+    for (size_t chunk = 0; chunk < task->chunks; ++chunk){
+        if (task->failed[chunk]){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void for_task(size_t chunk, void *arg){
+    paralleltask *task = arg;
+    size_t low;
+    size_t high;
+
+    get_chunk_bounds(task, chunk, &low, &high);
+
+    for (size_t index = low; index < high; ++index){
+        task->forfn(task->l, index, task->ctx);
+    }
+}
+
+static void map_task(size_t chunk, void *arg){
+    paralleltask *task = arg;
+    size_t low;
+    size_t high;
+
+    get_chunk_bounds(task, chunk, &low, &high);
+
+    for (size_t index = low; index < high; ++index){
+        list_item item = {0};
+
+        if (!task->mapfn(task->l->items[index], &item, task->ctx)){
+            task->failed[chunk] = true;
+
+            return;
+        }
+
+        if (item.data){
+            task->out[index] = item_init_pointer(
+                item.type,
+                item.size,
+                item.data,
+                item.generic_free
+            );
+        }
+        else {
+            task->out[index] = item_init(
+                item.type,
+                item.size,
+                item.data_copy,
+                item.generic_free
+            );
+        }
+
+        if (!task->out[index]){
+            task->failed[chunk] = true;
+
+            return;
+        }
+    }
+}
+
+static void filter_task(size_t chunk, void *arg){
+    paralleltask *task = arg;
+    size_t low;
+    size_t high;
+
+    get_chunk_bounds(task, chunk, &low, &high);
+
+    task->kept[chunk] = malloc((high - low + 1) * sizeof(**task->kept));
+
+    if (!task->kept[chunk]){
+        task->failed[chunk] = true;
+
+        return;
+    }
+
+    size_t kept = 0;
+
+    for (size_t index = low; index < high; ++index){
+        list_item *i = task->l->items[index];
+
+        if (task->filterfn(i, task->ctx)){
+            task->kept[chunk][kept++] = i;
+        }
+    }
+
+    task->keptlen[chunk] = kept;
+}
+
+static void reduce_task(size_t chunk, void *arg){
+    paralleltask *task = arg;
+    size_t low;
+    size_t high;
+
+    get_chunk_bounds(task, chunk, &low, &high);
+
+    void *acc = task->accs + chunk * task->accstride;
+
+    for (size_t index = low; index < high; ++index){
+        if (!task->reducefn(acc, task->l->items[index], task->ctx)){
+            task->failed[chunk] = true;
+
+            return;
+        }
+    }
+}
+
+list *list_init(void){
+    if (LIST_MINIMUM_SIZE <= 0){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_init() - LIST_MINIMUM_SIZE must be greater than 0\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    list *l = calloc(1, sizeof(*l));
+
+    if (!l){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_init() - list object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    l->length = 0;
+    l->size = LIST_MINIMUM_SIZE;
+    l->items = calloc(l->size, sizeof(*l->items));
+
+    if (!l->items){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_init() - items object alloc failed\n",
+            __FILE__
+        );
+
+        free(l);
+
+        return NULL;
+    }
+
+    return l;
+}
+
+list *list_copy(const list *l){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_copy() - list is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    list *copy = list_init();
+
+    if (!copy){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_copy() - list initialization failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    if (!list_extend(copy, l)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_copy() - list_extend call failed\n",
+            __FILE__
+        );
+
+        list_free(copy);
+
+        return NULL;
+    }
+
+    return copy;
+}
+
+list *list_view(const list *l, size_t offset, size_t length){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_view() - list is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+    else if (offset > l->length || length > l->length - offset){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_view() - range %ld+%ld is out of bounds\n",
+            __FILE__,
+            offset,
+            length
+        );
+
+        return NULL;
+    }
+
+    list *view = calloc(1, sizeof(*view));
+
+    if (!view){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_view() - view object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    view->items = l->items + offset;
+    view->length = length;
+    view->size = length;
+    view->view = true;
+
+    return view;
+}
+
+list *list_slice(const list *l, size_t offset, size_t length){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_slice() - list is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+    else if (offset > l->length || length > l->length - offset){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_slice() - range %ld+%ld is out of bounds\n",
+            __FILE__,
+            offset,
+            length
+        );
+
+        return NULL;
+    }
+
+    list *slice = list_init();
+
+    if (!slice){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_slice() - list initialization failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    if (!list_reserve(slice, length)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_slice() - list_reserve call failed\n",
+            __FILE__
+        );
+
+        list_free(slice);
+
+        return NULL;
+    }
+
+    /* share the items -- writes to either list replace its own pointer */
+    for (size_t index = 0; index < length; ++index){
+        list_item *i = l->items[offset + index];
+
+        ++get_node(i)->refs;
+
+        slice->items[index] = i;
+    }
+
+    slice->length = length;
+
+    return slice;
+}
+
+bool list_resize(list *l, size_t size){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_resize() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (size == 0 || size < LIST_MINIMUM_SIZE){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_resize() - size cannot be 0 or less than LIST_MINIMUM_SIZE -- set to LIST_MINIMUM_SIZE (%d)\n",
+            __FILE__,
+            LIST_MINIMUM_SIZE
+        );
+
+        size = LIST_MINIMUM_SIZE;
+    }
+
+    if (!check_writable(l, "list_resize")){
+        return false;
+    }
+
+    if (size < l->length){
+        for (size_t index = size; index < l->length; ++index){
+            item_free(l->items[index]);
+        }
+
+        l->length = size;
+    }
+
+    list_item **items = realloc(l->items, size * sizeof(*items));
+
+    if (!items){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_resize() - items object realloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    l->items = items;
+    l->size = size;
+
+    return true;
+}
+
+bool list_reserve(list *l, size_t size){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_reserve() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_writable(l, "list_reserve")){
+        return false;
+    }
+
+    /* appends grow once length + 1 reaches size -- keep one slot spare */
+    if (size < l->size){
+        return true;
+    }
+
+    if (!list_resize(l, size + 1)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_reserve() - list_resize call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
 
 size_t list_get_length(const list *l){
     if (!l){
         log_write(
             logger,
-            LOG_WARNING,
-            "[%s] list_get_length() - list is NULL\n",
+            LOG_WARNING,
+            "[%s] list_get_length() - list is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return l->length;
+}
+
+size_t list_get_size(const list *l){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_get_size() - list is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return l->size;
+}
+
+size_t list_get_item_size(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return 0;
+    }
+
+    return i->size;
+}
+
+bool list_contains(const list *l, size_t size, const void *data){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_contains() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    for (size_t index = 0; index < l->length; ++index){
+        const list_item *i = get_item(l, index, L_TYPE_RESERVED_EMPTY);
+
+        if (size == i->size && memcmp(data, i->data, i->size)){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ltype list_get_type(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_RESERVED_EMPTY);
+
+    if (!i){
+        return L_TYPE_RESERVED_ERROR;
+    }
+
+    return i->type;
+}
+
+bool list_get_bool(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_BOOL);
+
+    if (!i){
+        return false;
+    }
+
+    return *(bool *)i->data;
+}
+
+char list_get_char(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_CHAR);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(char *)i->data;
+}
+
+double list_get_double(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_DOUBLE);
+
+    if (!i){
+        return 0.0;
+    }
+
+    return *(double *)i->data;
+}
+
+int64_t list_get_int(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_INT);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(int64_t *)i->data;
+}
+
+uint64_t list_get_uint(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_UINT);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(uint64_t *)i->data;
+}
+
+size_t list_get_size_t(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_SIZE_T);
+
+    if (!i){
+        return 0;
+    }
+
+    return *(size_t *)i->data;
+}
+
+string_view list_get_view(const list *l, size_t pos){
+    string_view view = {0};
+    const list_item *i = get_item(l, pos, L_TYPE_STRING);
+
+    if (!i || i->type != L_TYPE_STRING){
+        return view;
+    }
+
+    view.data = i->data;
+    view.length = i->size;
+
+    return view;
+}
+
+/*
+ * READ WARNING FOR THESE FUNCTIONS IN HEADER FILE
+ */
+char *list_get_string(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_STRING);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+list *list_get_list(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_LIST);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+map *list_get_map(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_MAP);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+void *list_get_generic(const list *l, size_t pos){
+    const list_item *i = get_item(l, pos, L_TYPE_GENERIC);
+
+    if (!i){
+        return NULL;
+    }
+
+    return i->data;
+}
+
+bool list_sort(list *l, list_compare cmp){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_sort() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (l->length < 2){
+        return true;
+    }
+
+    if (!check_writable(l, "list_sort")){
+        return false;
+    }
+
+    list_item **tmp = malloc(l->length * sizeof(*tmp));
+
+    if (!tmp){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_sort() - tmp alloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    bool success = sort_range(
+        l->items,
+        tmp,
+        l->length,
+        get_sort_type(l, cmp),
+        cmp
+    );
+
+    free(tmp);
+
+    if (!success){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_sort() - sort_range call failed\n",
+            __FILE__
+        );
+    }
+
+    return success;
+}
+
+bool list_sort_parallel(list *l, list_compare cmp, size_t threads){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_sort_parallel() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_writable(l, "list_sort_parallel")){
+        return false;
+    }
+
+    if (threads == 0){
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+        threads = online > 0 ? online : 1;
+    }
+
+    if (threads > l->length / LIST_SORT_PARALLEL_MINIMUM){
+        threads = l->length / LIST_SORT_PARALLEL_MINIMUM;
+    }
+
+    if (threads <= 1){
+        return list_sort(l, cmp);
+    }
+
+    list_item **tmp = malloc(l->length * sizeof(*tmp));
+    size_t *bounds = malloc((threads + 1) * sizeof(*bounds));
+    sorttask *sorts = calloc(threads, sizeof(*sorts));
+    mergetask *merges = calloc(threads, sizeof(*merges));
+    pthread_t *workers = calloc(threads, sizeof(*workers));
+    bool *started = calloc(threads, sizeof(*started));
+
+    if (!tmp || !bounds || !sorts || !merges || !workers || !started){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_sort_parallel() - task alloc failed\n",
             __FILE__
         );
 
-        return 0;
+        free(tmp);
+        free(bounds);
+        free(sorts);
+        free(merges);
+        free(workers);
+        free(started);
+
+        return false;
     }
 
-    return l->length;
+    ltype type = get_sort_type(l, cmp);
+
+    for (size_t index = 0; index <= threads; ++index){
+        bounds[index] = l->length / threads * index;
+    }
+
+    bounds[threads] = l->length;
+
+    /* sort each chunk on its own thread -- chunk 0 runs here */
+    for (size_t index = 0; index < threads; ++index){
+        sorttask *task = &sorts[index];
+
+        task->items = &l->items[bounds[index]];
+        task->tmp = &tmp[bounds[index]];
+        task->length = bounds[index + 1] - bounds[index];
+        task->type = type;
+        task->cmp = cmp;
+
+        if (index){
+            started[index] = !pthread_create(&workers[index], NULL, sort_worker, task);
+        }
+    }
+
+    for (size_t index = 0; index < threads; ++index){
+        if (!index || !started[index]){
+            sort_worker(&sorts[index]);
+        }
+        else {
+            pthread_join(workers[index], NULL);
+        }
+    }
+
+    bool success = true;
+
+    for (size_t index = 0; index < threads; ++index){
+        success = success && sorts[index].success;
+    }
+
+    /* merge neighbouring chunks pairwise until one run is left */
+    list_item **src = l->items;
+    list_item **dst = tmp;
+    size_t chunks = threads;
+
+    while (success && chunks > 1){
+        size_t pairs = chunks / 2;
+
+        for (size_t index = 0; index < pairs; ++index){
+            mergetask *task = &merges[index];
+
+            task->src = src;
+            task->dst = dst;
+            task->low = bounds[index * 2];
+            task->mid = bounds[index * 2 + 1];
+            task->high = bounds[index * 2 + 2];
+            task->cmp = cmp ? cmp : compare_default;
+
+            started[index] = index && !pthread_create(&workers[index], NULL, merge_worker, task);
+        }
+
+        for (size_t index = 0; index < pairs; ++index){
+            if (!started[index]){
+                merge_worker(&merges[index]);
+            }
+            else {
+                pthread_join(workers[index], NULL);
+            }
+        }
+
+        if (chunks % 2){
+            size_t low = bounds[chunks - 1];
+
+            memcpy(&dst[low], &src[low], (l->length - low) * sizeof(*dst));
+        }
+
+        for (size_t index = 0; index <= pairs; ++index){
+            bounds[index] = bounds[index * 2 < chunks ? index * 2 : chunks];
+        }
+
+        chunks = pairs + chunks % 2;
+        bounds[chunks] = l->length;
+
+        list_item **hold = src;
+
+        src = dst;
+        dst = hold;
+    }
+
+    if (success && src != l->items){
+        memcpy(l->items, src, l->length * sizeof(*l->items));
+    }
+
+    free(tmp);
+    free(bounds);
+    free(sorts);
+    free(merges);
+    free(workers);
+    free(started);
+
+    if (!success){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_sort_parallel() - chunk sort failed\n",
+            __FILE__
+        );
+    }
+
+    return success;
 }
 
-size_t list_get_size(const list *l){
+size_t list_lower_bound(const list *l, list_compare cmp, const list_item *key){
     if (!l){
         log_write(
             logger,
             LOG_WARNING,
-            "[%s] list_get_size() - list is NULL\n",
+            "[%s] list_lower_bound() - list is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+    else if (!key){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_lower_bound() - key is NULL\n",
             __FILE__
         );
 
         return 0;
     }
 
-    return l->size;
-}
+    if (!cmp){
+        cmp = compare_default;
+    }
 
-size_t list_get_item_size(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_RESERVED_EMPTY);
+    size_t low = 0;
+    size_t high = l->length;
 
-    if (!i){
-        return 0;
+    while (low < high){
+        size_t mid = low + (high - low) / 2;
+
+        if (cmp(l->items[mid], key) < 0){
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
     }
 
-    return i->size;
+    return low;
 }
 
-bool list_contains(const list *l, size_t size, const void *data){
+bool list_bsearch(const list *l, list_compare cmp, const list_item *key, size_t *pos){
     if (!l){
         log_write(
             logger,
             LOG_WARNING,
-            "[%s] list_contains() - list is NULL\n",
+            "[%s] list_bsearch() - list is NULL\n",
             __FILE__
         );
 
         return false;
     }
+    else if (!key){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_bsearch() - key is NULL\n",
+            __FILE__
+        );
 
-    for (size_t index = 0; index < l->length; ++index){
-        const list_item *i = get_item(l, index, L_TYPE_RESERVED_EMPTY);
+        return false;
+    }
 
-        if (size == i->size && memcmp(data, i->data, i->size)){
-            return true;
-        }
+    size_t index = list_lower_bound(l, cmp, key);
+
+    if (index >= l->length || (cmp ? cmp : compare_default)(l->items[index], key)){
+        return false;
     }
 
-    return false;
+    if (pos){
+        *pos = index;
+    }
+
+    return true;
 }
 
-ltype list_get_type(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_RESERVED_EMPTY);
+bool list_parallel_for(threadpool *pool, const list *l, list_for_fn fn, void *ctx){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_for() - list is NULL\n",
+            __FILE__
+        );
 
-    if (!i){
-        return L_TYPE_RESERVED_ERROR;
+        return false;
     }
+    else if (!fn){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_for() - fn is NULL\n",
+            __FILE__
+        );
 
-    return i->type;
-}
+        return false;
+    }
 
-bool list_get_bool(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_BOOL);
+    paralleltask task = {0};
+    task.l = l;
+    task.chunks = get_chunk_count(pool, l->length);
+    task.ctx = ctx;
+    task.forfn = fn;
+
+    if (!run_parallel(pool, for_task, &task)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_for() - run_parallel call failed\n",
+            __FILE__
+        );
 
-    if (!i){
         return false;
     }
 
-    return *(bool *)i->data;
+    return true;
 }
 
-char list_get_char(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_CHAR);
+list *list_parallel_map(threadpool *pool, const list *l, list_map_fn fn, void *ctx){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_map() - list is NULL\n",
+            __FILE__
+        );
 
-    if (!i){
-        return 0;
+        return NULL;
     }
+    else if (!fn){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_map() - fn is NULL\n",
+            __FILE__
+        );
 
-    return *(char *)i->data;
-}
+        return NULL;
+    }
 
-double list_get_double(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_DOUBLE);
+    list *out = list_init();
 
-    if (!i){
-        return 0.0;
+    if (!out){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_map() - list initialization failed\n",
+            __FILE__
+        );
+
+        return NULL;
     }
 
-    return *(double *)i->data;
-}
+    paralleltask task = {0};
+    task.l = l;
+    task.chunks = get_chunk_count(pool, l->length);
+    task.ctx = ctx;
+    task.mapfn = fn;
+    task.failed = calloc(task.chunks, sizeof(*task.failed));
 
-int64_t list_get_int(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_INT);
+    if (!task.failed || !list_reserve(out, l->length)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_map() - task alloc failed\n",
+            __FILE__
+        );
 
-    if (!i){
-        return 0;
+        free(task.failed);
+        list_free(out);
+
+        return NULL;
     }
 
-    return *(int64_t *)i->data;
+    /* every input maps to exactly one output slot */
+    task.out = out->items;
+
+    memset(task.out, 0, l->length * sizeof(*task.out));
+
+    bool success = run_parallel(pool, map_task, &task) && !check_failed(&task);
+
+    free(task.failed);
+
+    if (!success){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_map() - map failed\n",
+            __FILE__
+        );
+
+        for (size_t index = 0; index < l->length; ++index){
+            if (task.out[index]){
+                item_free(task.out[index]);
+            }
+        }
+
+        list_free(out);
+
+        return NULL;
+    }
+
+    out->length = l->length;
+
+    return out;
 }
 
-uint64_t list_get_uint(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_UINT);
+list *list_parallel_filter(threadpool *pool, const list *l, list_filter_fn fn, void *ctx){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_filter() - list is NULL\n",
+            __FILE__
+        );
 
-    if (!i){
-        return 0;
+        return NULL;
+    }
+    else if (!fn){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_filter() - fn is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
     }
 
-    return *(uint64_t *)i->data;
+    paralleltask task = {0};
+    task.l = l;
+    task.chunks = get_chunk_count(pool, l->length);
+    task.ctx = ctx;
+    task.filterfn = fn;
+    task.kept = calloc(task.chunks, sizeof(*task.kept));
+    task.keptlen = calloc(task.chunks, sizeof(*task.keptlen));
+    task.failed = calloc(task.chunks, sizeof(*task.failed));
+
+    list *out = NULL;
+    bool success = task.kept && task.keptlen && task.failed;
+
+    if (success){
+        success = run_parallel(pool, filter_task, &task) && !check_failed(&task);
+    }
+
+    if (success){
+        size_t length = 0;
+
+        for (size_t chunk = 0; chunk < task.chunks; ++chunk){
+            length += task.keptlen[chunk];
+        }
+
+        out = list_init();
+        success = out && list_reserve(out, length);
+    }
+
+    if (success){
+        /* merge the per-chunk buffers in order, sharing the items */
+        for (size_t chunk = 0; chunk < task.chunks; ++chunk){
+            for (size_t index = 0; index < task.keptlen[chunk]; ++index){
+                list_item *i = task.kept[chunk][index];
+
+                ++get_node(i)->refs;
+
+                out->items[out->length++] = i;
+            }
+        }
+    }
+    else {
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_filter() - filter failed\n",
+            __FILE__
+        );
+
+        list_free(out);
+
+        out = NULL;
+    }
+
+    for (size_t chunk = 0; task.kept && chunk < task.chunks; ++chunk){
+        free(task.kept[chunk]);
+    }
+
+    free(task.kept);
+    free(task.keptlen);
+    free(task.failed);
+
+    return out;
 }
 
-size_t list_get_size_t(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_SIZE_T);
+bool list_parallel_reduce(threadpool *pool, const list *l, list_reduce_fn fn, list_combine_fn combine, void *acc, size_t accsize, void *ctx){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_reduce() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!fn || !combine){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_reduce() - fn or combine is NULL\n",
+            __FILE__
+        );
 
-    if (!i){
-        return 0;
+        return false;
     }
+    else if (!acc || !accsize){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_parallel_reduce() - accumulator is NULL or empty\n",
+            __FILE__
+        );
 
-    return *(size_t *)i->data;
-}
+        return false;
+    }
 
-/*
- * READ WARNING FOR THESE FUNCTIONS IN HEADER FILE
- */
-char *list_get_string(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_STRING);
+    paralleltask task = {0};
+    task.l = l;
+    task.chunks = get_chunk_count(pool, l->length);
+    task.ctx = ctx;
+    task.reducefn = fn;
+    task.accstride = (accsize + LIST_CACHE_LINE - 1) / LIST_CACHE_LINE * LIST_CACHE_LINE;
+    task.accs = aligned_alloc(LIST_CACHE_LINE, task.chunks * task.accstride);
+    task.failed = calloc(task.chunks, sizeof(*task.failed));
 
-    if (!i){
-        return NULL;
-    }
+    if (!task.accs || !task.failed){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_reduce() - task alloc failed\n",
+            __FILE__
+        );
 
-    return i->data;
-}
+        free(task.accs);
+        free(task.failed);
 
-list *list_get_list(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_LIST);
+        return false;
+    }
 
-    if (!i){
-        return NULL;
+    for (size_t chunk = 0; chunk < task.chunks; ++chunk){
+        memcpy(task.accs + chunk * task.accstride, acc, accsize);
     }
 
-    return i->data;
-}
+    bool success = run_parallel(pool, reduce_task, &task) && !check_failed(&task);
 
-map *list_get_map(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_MAP);
+    if (success){
+        memcpy(acc, task.accs, accsize);
 
-    if (!i){
-        return NULL;
+        for (size_t chunk = 1; success && chunk < task.chunks; ++chunk){
+            success = combine(acc, task.accs + chunk * task.accstride, ctx);
+        }
     }
 
-    return i->data;
-}
-
-void *list_get_generic(const list *l, size_t pos){
-    const list_item *i = get_item(l, pos, L_TYPE_GENERIC);
-
-    if (!i){
-        return NULL;
+    if (!success){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_parallel_reduce() - reduce failed\n",
+            __FILE__
+        );
     }
 
-    return i->data;
+    free(task.accs);
+    free(task.failed);
+
+    return success;
 }
 
 bool list_replace(list *l, size_t pos, const list_item *item){
@@ -586,6 +2075,10 @@ bool list_replace(list *l, size_t pos, const list_item *item){
         return false;
     }
 
+    if (!check_writable(l, "list_replace")){
+        return false;
+    }
+
     list_item *i = NULL;
 
     if (item->data){
@@ -648,6 +2141,10 @@ bool list_insert(list *l, size_t pos, const list_item *item){
         return list_append(l, item);
     }
 
+    if (!check_writable(l, "list_insert")){
+        return false;
+    }
+
     if (!check_availability(l)){
         log_write(
             logger,
@@ -699,6 +2196,26 @@ bool list_insert(list *l, size_t pos, const list_item *item){
     return true;
 }
 
+bool list_append_view(list *l, string_view view){
+    if (!view.data){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_append_view() - view is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    list_item item = {0};
+    item.type = L_TYPE_STRING;
+    item.size = view.length;
+    item.data_copy = view.data;
+
+    return list_append(l, &item);
+}
+
 bool list_append(list *l, const list_item *item){
     if (!l){
         log_write(
@@ -721,6 +2238,10 @@ bool list_append(list *l, const list_item *item){
         return false;
     }
 
+    if (!check_writable(l, "list_append")){
+        return false;
+    }
+
     if (!check_availability(l)){
         log_write(
             logger,
@@ -767,25 +2288,263 @@ bool list_append(list *l, const list_item *item){
     return true;
 }
 
+bool list_extend(list *l, const list *other){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_extend() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!other){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_extend() - other list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_writable(l, "list_extend")){
+        return false;
+    }
+
+    size_t length = l->length;
+    size_t count = other->length;
+
+    if (!list_reserve(l, length + count)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_extend() - list_reserve call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    itemslab *slab = NULL;
+
+    for (size_t index = 0; index < count; ++index){
+        /* read through other after reserving in case l == other */
+        const list_item *i = other->items[index];
+        list_item *copy = item_carve(&slab, count - index, i->type, i->size, i->data, i->generic_free);
+
+        if (!copy){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] list_extend() - item object initialization failed\n",
+                __FILE__
+            );
+
+            truncate_items(l, length);
+            slab_retire(slab);
+
+            return false;
+        }
+
+        l->items[l->length++] = copy;
+    }
+
+    slab_retire(slab);
+
+    return true;
+}
+
+bool list_extend_int(list *l, const int64_t *values, size_t count){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_extend_int() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!values && count){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_extend_int() - values is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_writable(l, "list_extend_int")){
+        return false;
+    }
+
+    size_t length = l->length;
+
+    if (!list_reserve(l, length + count)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_extend_int() - list_reserve call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    itemslab *slab = NULL;
+
+    for (size_t index = 0; index < count; ++index){
+        list_item *i = item_carve(
+            &slab,
+            count - index,
+            L_TYPE_INT,
+            sizeof(*values),
+            &values[index],
+            NULL
+        );
+
+        if (!i){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] list_extend_int() - item object initialization failed\n",
+                __FILE__
+            );
+
+            truncate_items(l, length);
+            slab_retire(slab);
+
+            return false;
+        }
+
+        l->items[l->length++] = i;
+    }
+
+    slab_retire(slab);
+
+    return true;
+}
+
+bool list_extend_strings(list *l, const char **strings, const size_t *lengths, size_t count){
+    if (!l){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_extend_strings() - list is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!strings && count){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] list_extend_strings() - strings is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (!check_writable(l, "list_extend_strings")){
+        return false;
+    }
+
+    size_t length = l->length;
+
+    if (!list_reserve(l, length + count)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] list_extend_strings() - list_reserve call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    itemslab *slab = NULL;
+
+    for (size_t index = 0; index < count; ++index){
+        const char *string = strings[index];
+
+        if (!string){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] list_extend_strings() - string at index %ld is NULL\n",
+                __FILE__,
+                index
+            );
+
+            truncate_items(l, length);
+            slab_retire(slab);
+
+            return false;
+        }
+
+        list_item *i = item_carve(
+            &slab,
+            count - index,
+            L_TYPE_STRING,
+            lengths ? lengths[index] : strlen(string),
+            string,
+            NULL
+        );
+
+        if (!i){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] list_extend_strings() - item object initialization failed\n",
+                __FILE__
+            );
+
+            truncate_items(l, length);
+            slab_retire(slab);
+
+            return false;
+        }
+
+        l->items[l->length++] = i;
+    }
+
+    slab_retire(slab);
+
+    return true;
+}
+
 void list_pop(list *l, size_t pos, list_item *item){
     list_item *i = get_item(l, pos, L_TYPE_RESERVED_EMPTY);
 
-    if (!i){
+    if (!i || !check_writable(l, "list_pop")){
         return;
     }
 
     if (item){
-        item->type = i->type;
-        item->size = i->size;
-        item->data = i->data;
-        item->generic_free = i->generic_free;
+        list_item taken = *i;
+
+        if (!item_take_data(i, &taken.data)){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] list_pop() - item_take_data call failed\n",
+                __FILE__
+            );
 
-        if (item->data){
-            i->type = L_TYPE_NULL;
-            i->size = 0;
-            i->data = NULL;
-            i->generic_free = NULL;
+            return;
         }
+
+        item->type = taken.type;
+        item->size = taken.size;
+        item->data = taken.data;
+        item->generic_free = taken.generic_free;
     }
     else {
         log_write(
@@ -822,6 +2581,10 @@ void list_remove(list *l, size_t pos){
         return;
     }
 
+    if (!check_writable(l, "list_remove")){
+        return;
+    }
+
     item_free(l->items[pos]);
 
     for (size_t index = pos; index < l->length; ++index){
@@ -868,6 +2631,10 @@ void list_empty(list *l){
         return;
     }
 
+    if (!check_writable(l, "list_empty")){
+        return;
+    }
+
     for (size_t index = 0; index < l->length; ++index){
         list_remove(l, index);
     }
@@ -885,6 +2652,13 @@ void list_free(list *l){
         return;
     }
 
+    if (l->view){
+        /* items belong to the parent list */
+        free(l);
+
+        return;
+    }
+
     for (size_t index = 0; index < l->length; ++index){
         item_free(l->items[index]);
     }
@@ -2,12 +2,14 @@
 #define LIST_H
 
 #include "map.h"
+#include "strview.h"
 
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 typedef struct map map;
+typedef struct threadpool threadpool;
 
 typedef enum {
     L_TYPE_BOOL,
@@ -36,15 +38,50 @@ typedef struct list_item {
     list_generic_free generic_free;
 } list_item;
 
+/*
+ * returns <0, 0 or >0 like strcmp -- passing NULL to the
+ * sort and search functions uses the built-in ordering
+ * (by type first, then by value)
+ */
+typedef int (*list_compare)(const list_item *, const list_item *);
+
 typedef struct list {
     list_item **items;
     size_t length;
     size_t size;
+
+    bool view;
 } list;
 
+/*
+ * callbacks for the list_parallel_* functions -- they run
+ * concurrently on pool threads and must not modify the list.
+ * map fills the output item the same way as for list_append
+ */
+typedef void (*list_for_fn)(const list *, size_t, void *);
+typedef bool (*list_map_fn)(const list_item *, list_item *, void *);
+typedef bool (*list_filter_fn)(const list_item *, void *);
+typedef bool (*list_reduce_fn)(void *, const list_item *, void *);
+typedef bool (*list_combine_fn)(void *, const void *, void *);
+
 list *list_init(void);
 list *list_copy(const list *);
+
+/*
+ * a view borrows a range of the parent's items and is read-only --
+ * it MUST NOT outlive the parent or be used after the parent is
+ * modified. list_free only releases the view itself.
+ *
+ * a slice is a normal list that shares the parent's items, replacing,
+ * removing or popping items in either list does not affect the other.
+ * the data behind the list_get_* pointer functions is still shared.
+ * popping a shared item hands out a copy, except for L_TYPE_GENERIC
+ * data which can't be copied -- that pop fails and leaves the item
+ */
+list *list_view(const list *, size_t, size_t);
+list *list_slice(const list *, size_t, size_t);
 bool list_resize(list *, size_t);
+bool list_reserve(list *, size_t);
 
 size_t list_get_length(const list *);
 size_t list_get_size(const list *);
@@ -60,6 +97,9 @@ int64_t list_get_int(const list *, size_t);
 uint64_t list_get_uint(const list *, size_t);
 size_t list_get_size_t(const list *, size_t);
 
+/* view of a string item -- valid until the item is removed */
+string_view list_get_view(const list *, size_t);
+
 /* ------------------ WARNING ------------------
  * the data at these pointers can be modified but
  * the pointer MUST NOT be free'd! the size of the
@@ -72,9 +112,40 @@ list *list_get_list(const list *, size_t);
 map *list_get_map(const list *, size_t);
 void *list_get_generic(const list *, size_t);
 
+bool list_sort(list *, list_compare);
+bool list_sort_parallel(list *, list_compare, size_t);
+bool list_bsearch(const list *, list_compare, const list_item *, size_t *);
+size_t list_lower_bound(const list *, list_compare, const list_item *);
+
+/*
+ * the index range is split into chunks that run on the pool
+ * (or the calling thread when the pool is NULL) and results
+ * keep the input order. filtered lists share items with the
+ * input the same way list_slice does.
+ *
+ * reduce copies the accumulator (which must hold the identity
+ * value and plain data only) into one accumulator per chunk,
+ * then combines those in order back into it
+ */
+bool list_parallel_for(threadpool *, const list *, list_for_fn, void *);
+list *list_parallel_map(threadpool *, const list *, list_map_fn, void *);
+list *list_parallel_filter(threadpool *, const list *, list_filter_fn, void *);
+bool list_parallel_reduce(threadpool *, const list *, list_reduce_fn, list_combine_fn, void *, size_t, void *);
+
 bool list_replace(list *, size_t, const list_item *);
 bool list_insert(list *, size_t, const list_item *);
 bool list_append(list *, const list_item *);
+bool list_append_view(list *, string_view);
+
+/*
+ * each of these does one capacity check up front and carves the
+ * new items from shared 64KiB slabs instead of a malloc apiece,
+ * a slab being freed once all of its items are -- lengths may be
+ * NULL for NUL terminated strings
+ */
+bool list_extend(list *, const list *);
+bool list_extend_int(list *, const int64_t *, size_t);
+bool list_extend_strings(list *, const char **, const size_t *, size_t);
 
 void list_pop(list *, size_t, list_item *);
 void list_remove(list *, size_t);
@@ -1,10 +1,13 @@
 #include "log.h"
 
+#include "fmt.h"
 #include "str.h"
 
 #include <errno.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 logctx *log_init(const char *filename, FILE *stream){
     logctx *log = malloc(sizeof(*log));
@@ -63,6 +66,8 @@ bool log_write(const logctx *log, logtype type, const char *format, ...){
     char timestamp[LOG_TIMESTAMP_LENGTH];
 
     if (!string_from_time(0, true, LOG_TIMESTAMP_FORMAT, timestamp, sizeof(timestamp))){
+        timestamp[0] = '\0';
+
         DLOG(
             "[%s] log_write() - failed to get timestamp string: %s\n",
             __FILE__,
@@ -96,24 +101,86 @@ bool log_write(const logctx *log, logtype type, const char *format, ...){
         );
     }
 
-    if (typestr){
-        fprintf(handle, "(%s) %s ", timestamp, typestr);
-    }
-    else if (type != LOG_RAW) {
-        fprintf(handle, "(%s) ", timestamp);
+    /* the whole line is formatted first and reaches the stream in one write */
+    char line[LOG_LINE_SIZE];
+    size_t prefix = 0;
+
+    if (type != LOG_RAW){
+        size_t length = strlen(timestamp);
+
+        line[prefix++] = '(';
+        memcpy(line + prefix, timestamp, length);
+        prefix += length;
+        line[prefix++] = ')';
+        line[prefix++] = ' ';
+
+        if (typestr){
+            length = strlen(typestr);
+
+            memcpy(line + prefix, typestr, length);
+            prefix += length;
+            line[prefix++] = ' ';
+        }
     }
 
-    va_list args;
+    va_list args, argscpy;
 
     va_start(args, format);
+    va_copy(argscpy, args);
+
+    char *data = line;
+    size_t length = fmt_vsnprintf(line + prefix, sizeof(line) - prefix, format, argscpy);
+
+    va_end(argscpy);
+
+    if (length == SIZE_MAX){
+        /* the format engine gave up, let stdio have a go */
+        fwrite(line, 1, prefix, handle);
+
+        int err = vfprintf(handle, format, args);
+
+        va_end(args);
+
+        if (err < 0){
+            DLOG(
+                "[%s] log_write() - vfprintf call failed\n",
+                __FILE__
+            );
+
+            return false;
+        }
+
+        return true;
+    }
+    else if (length >= sizeof(line) - prefix){
+        data = malloc(prefix + length + 1);
+
+        if (data){
+            memcpy(data, line, prefix);
+            fmt_vsnprintf(data + prefix, length + 1, format, args);
+        }
+        else {
+            DLOG(
+                "[%s] log_write() - line alloc failed, truncating\n",
+                __FILE__
+            );
 
-    int err = vfprintf(handle, format, args);
+            data = line;
+            length = sizeof(line) - prefix - 1;
+        }
+    }
 
     va_end(args);
 
-    if (err < 0){
+    size_t written = fwrite(data, 1, prefix + length, handle);
+
+    if (data != line){
+        free(data);
+    }
+
+    if (written != prefix + length){
         DLOG(
-            "[%s] log_write() - vfprintf call failed\n",
+            "[%s] log_write() - fwrite call failed\n",
             __FILE__
         );
 
@@ -7,6 +7,7 @@
 #define LOG_DEFAULT_STREAM stderr
 #define LOG_TIMESTAMP_FORMAT "%m/%d/%Y %H:%M:%S"
 #define LOG_TIMESTAMP_LENGTH 32
+#define LOG_LINE_SIZE 512
 
 #ifdef DEBUG
 #define DLOG(...) fprintf(LOG_DEFAULT_STREAM, __VA_ARGS__)
@@ -3,13 +3,14 @@
 #include "log.h"
 #include "str.h"
 
-#include "hashers/spooky.h"
+#include "hashers/xxh3.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
 #define MAP_MINIMUM_SIZE 8
 #define MAP_GROWTH_LOAD_FACTOR 0.8
+#define MAP_BATCH_SIZE 64
 
 #define LCG_MULTIPLIER 6364136223846793005
 #define LCG_INCREMENT 1
@@ -17,7 +18,7 @@
 static logctx *logger = NULL;
 
 typedef struct node {
-    uint32_t hash;
+    uint64_t hash;
 
     map_item *key;
     map_item *value;
@@ -30,11 +31,37 @@ static bool is_power_of_two(size_t number){
     return number && !(number & (number - 1));
 }
 
-static uint32_t generate_hash(uint32_t seed, size_t size, const void *data){
-    return spooky_hash32(data, size, seed);
+static uint64_t generate_hash(const map *m, size_t size, const void *data){
+    if (m->hasher){
+        return m->hasher(data, size, m->seed);
+    }
+
+    return xxh3_hash64(data, size, m->seed);
+}
+
+/* custom hashers are called per key, the default hashes them in lanes */
+static void generate_hashes(const map *m, size_t count, const void *const *keys, const size_t *sizes, uint64_t *hashes){
+    if (m->hasher){
+        for (size_t index = 0; index < count; ++index){
+            hashes[index] = m->hasher(keys[index], sizes[index], m->seed);
+        }
+
+        return;
+    }
+
+    xxh3_hash64_batch(keys, sizes, count, m->seed, hashes);
 }
 
-static size_t generate_index(uint32_t seed, size_t size){
+static bool keys_equal(const map *m, size_t size, const void *data, const map_item *key){
+    if (m->key_equal){
+        return m->key_equal(data, size, key->data, key->size);
+    }
+
+    /* atom keys looked up by atom match on the pointer alone */
+    return size == key->size && (data == key->data || !memcmp(data, key->data, size));
+}
+
+static size_t generate_index(uint64_t seed, size_t size){
     size_t multiplier = LCG_MULTIPLIER;
     size_t increment = LCG_INCREMENT;
 
@@ -108,7 +135,10 @@ static map_item *item_init(mtype type, size_t size, const void *data, map_generi
     i->size = size;
     i->generic_free = generic_free;
 
-    if (type == M_TYPE_STRING){
+    if (type == M_TYPE_ATOM){
+        i->data = (void *)data;
+    }
+    else if (type == M_TYPE_STRING){
         i->data = malloc(size + 1);
 
         if (!i->data){
@@ -124,7 +154,9 @@ static map_item *item_init(mtype type, size_t size, const void *data, map_generi
             return NULL;
         }
 
-        string_copy(data, i->data, size);
+        memcpy(i->data, data, size);
+
+        ((char *)i->data)[size] = '\0';
     }
     else if (type == M_TYPE_LIST){
         i->data = list_copy(data);
@@ -213,6 +245,7 @@ static void item_free(map_item *i){
         map_free(i->data);
 
         break;
+    case M_TYPE_ATOM:
     case M_TYPE_NULL:
         break;
     default:
@@ -303,6 +336,24 @@ static void node_free(node *n){
     free(n);
 }
 
+static bool find_node(const map *m, uint64_t hash, size_t size, const void *key, size_t *ret){
+    size_t index = generate_index(hash, m->size);
+    node *n = m->nodes[index];
+
+    for (size_t count = 0; count < m->size; ++count){
+        if (n && hash == n->hash && keys_equal(m, size, key, n->key)){
+            *ret = index;
+
+            return true;
+        }
+
+        index = generate_index(index, m->size);
+        n = m->nodes[index];
+    }
+
+    return false;
+}
+
 static bool get_node_index(const map *m, size_t *ret, size_t size, const void *key){
     if (!m){
         log_write(
@@ -325,24 +376,7 @@ static bool get_node_index(const map *m, size_t *ret, size_t size, const void *k
         return false;
     }
 
-    uint32_t hash = generate_hash(m->seed, size, key);
-    size_t index = generate_index(hash, m->size);
-    node *n = m->nodes[index];
-
-    bool found = false;
-
-    for (size_t count = 0; count < m->size; ++count){
-        if (n && hash == n->hash && !memcmp(key, n->key->data, n->key->size)){
-            found = true;
-
-            break;
-        }
-
-        index = generate_index(index, m->size);
-        n = m->nodes[index];
-    }
-
-    if (!found){
+    if (!find_node(m, generate_hash(m, size, key), size, key, ret)){
         log_write(
             logger,
             LOG_DEBUG,
@@ -353,8 +387,6 @@ static bool get_node_index(const map *m, size_t *ret, size_t size, const void *k
         return false;
     }
 
-    *ret = index;
-
     return true;
 }
 
@@ -400,6 +432,99 @@ static node *get_node(const map *m, size_t size, const void *key, mtype type){
     return n;
 }
 
+static bool set_node(map *m, const map_item *key, const map_item *value, uint64_t hash){
+    if (!check_availability(m)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] set_node() - check_availability call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    size_t index = generate_index(hash, m->size);
+    node *n = m->nodes[index];
+
+    for (size_t count = 0; count < m->size; ++count){
+        if (!n){
+            break;
+        }
+
+        if (hash == n->hash && keys_equal(m, key->size, key->data_copy, n->key)){
+            map_item *tmp = NULL;
+
+            if (value->data){
+                tmp = item_init_pointer(
+                    value->type,
+                    value->size,
+                    value->data,
+                    value->generic_free
+                );
+            }
+            else {
+                tmp = item_init(
+                    value->type,
+                    value->size,
+                    value->data_copy,
+                    value->generic_free
+                );
+            }
+
+            if (!tmp){
+                log_write(
+                    logger,
+                    LOG_ERROR,
+                    "[%s] set_node() - item initialization failed\n",
+                    __FILE__
+                );
+
+                return false;
+            }
+
+            item_free(n->value);
+
+            n->value = tmp;
+
+            return true;
+        }
+
+        index = generate_index(index, m->size);
+        n = m->nodes[index];
+    }
+
+    n = node_init(key, value);
+
+    if (!n){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] set_node() - node initialization failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    n->hash = hash;
+    m->nodes[index] = n;
+
+    ++m->length;
+
+    if (m->first){
+        n->prev = m->last;
+        m->last->next = n;
+        m->last = n;
+    }
+    else {
+        m->first = n;
+        m->last = n;
+    }
+
+    return true;
+}
+
 map *map_init(void){
     if (MAP_MINIMUM_SIZE <= 0){
         log_write(
@@ -453,7 +578,10 @@ map *map_init(void){
         return NULL;
     }
 
-    m->seed = (uint32_t)&m;
+    m->seed = (uint64_t)(uintptr_t)&m;
+
+    m->hasher = NULL;
+    m->key_equal = NULL;
 
     m->first = NULL;
     m->last = NULL;
@@ -486,13 +614,22 @@ map *map_copy(const map *m){
         return NULL;
     }
 
+    copy->hasher = m->hasher;
+    copy->key_equal = m->key_equal;
+
     node *n = m->first;
 
     while (n){
-        const map_item *k = n->key;
-        const map_item *v = n->value;
+        /* stored items own their data -- hand it over as data_copy */
+        map_item k = *n->key;
+        k.data_copy = k.data;
+        k.data = NULL;
+
+        map_item v = *n->value;
+        v.data_copy = v.data;
+        v.data = NULL;
 
-        if (!map_set(copy, k, v)){
+        if (!map_set(copy, &k, &v)){
             log_write(
                 logger,
                 LOG_ERROR,
@@ -511,6 +648,34 @@ map *map_copy(const map *m){
     return copy;
 }
 
+bool map_set_hasher(map *m, map_hasher hasher, map_key_equal key_equal){
+    if (!m){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] map_set_hasher() - map is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (m->length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] map_set_hasher() - map is *not* empty\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    m->hasher = hasher;
+    m->key_equal = key_equal;
+
+    return true;
+}
+
 bool map_resize(map *m, size_t size){
     if (!m){
         log_write(
@@ -935,6 +1100,20 @@ size_t map_get_size_t(const map *m, size_t size, const void *key){
 /*
  * READ WARNING FOR THESE FUNCTIONS IN HEADER FILE
  */
+string_view map_get_view(const map *m, size_t size, const void *key){
+    string_view view = {0};
+    const node *n = get_node(m, size, key, M_TYPE_RESERVED_EMPTY);
+
+    if (!n || (n->value->type != M_TYPE_STRING && n->value->type != M_TYPE_ATOM)){
+        return view;
+    }
+
+    view.data = n->value->data;
+    view.length = n->value->size;
+
+    return view;
+}
+
 char *map_get_string(const map *m, size_t size, const void *key){
     const node *n = get_node(m, size, key, M_TYPE_STRING);
 
@@ -975,6 +1154,31 @@ void *map_get_generic(const map *m, size_t size, const void *key){
     return n->value->data;
 }
 
+bool map_set_view(map *m, string_view key, string_view value){
+    if (!key.data || !value.data){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] map_set_view() - key or value view is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    map_item k = {0};
+    k.type = M_TYPE_STRING;
+    k.size = key.length;
+    k.data_copy = key.data;
+
+    map_item v = {0};
+    v.type = M_TYPE_STRING;
+    v.size = value.length;
+    v.data_copy = value.data;
+
+    return map_set(m, &k, &v);
+}
+
 bool map_set(map *m, const map_item *key, const map_item *value){
     if (!m){
         log_write(
@@ -1007,97 +1211,134 @@ bool map_set(map *m, const map_item *key, const map_item *value){
         return false;
     }
 
-    if (!check_availability(m)){
+    return set_node(m, key, value, generate_hash(m, key->size, key->data_copy));
+}
+
+bool map_set_many(map *m, const map_item *keys, const map_item *values, size_t count){
+    if (!m){
         log_write(
             logger,
-            LOG_ERROR,
-            "[%s] map_set() - check_availability call failed\n",
+            LOG_WARNING,
+            "[%s] map_set_many() - map is NULL\n",
             __FILE__
         );
 
         return false;
     }
+    else if (count && (!keys || !values)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] map_set_many() - keys or values is NULL\n",
+            __FILE__
+        );
 
-    uint32_t hash = generate_hash(m->seed, key->size, key->data_copy);
-    size_t index = generate_index(hash, m->size);
-    node *n = m->nodes[index];
+        return false;
+    }
 
-    for (size_t count = 0; count < m->size; ++count){
-        if (!n){
-            break;
-        }
+    const void *data[MAP_BATCH_SIZE];
+    size_t sizes[MAP_BATCH_SIZE];
+    uint64_t hashes[MAP_BATCH_SIZE];
 
-        if (hash == n->hash && !memcmp(key->data_copy, n->key->data, n->key->size)){
-            map_item *tmp = NULL;
+    for (size_t start = 0; start < count; start += MAP_BATCH_SIZE){
+        size_t batch = count - start < MAP_BATCH_SIZE ? count - start : MAP_BATCH_SIZE;
 
-            if (value->data){
-                tmp = item_init_pointer(
-                    value->type,
-                    value->size,
-                    value->data,
-                    value->generic_free
-                );
-            }
-            else {
-                tmp = item_init(
-                    value->type,
-                    value->size,
-                    value->data_copy,
-                    value->generic_free
-                );
-            }
+        for (size_t index = 0; index < batch; ++index){
+            const map_item *key = &keys[start + index];
 
-            if (!tmp){
+            if (key->data){
                 log_write(
                     logger,
-                    LOG_ERROR,
-                    "[%s] map_set() - item initialization failed\n",
+                    LOG_WARNING,
+                    "[%s] map_set_many() - key will *always* be copied -- set key in data_copy instead\n",
                     __FILE__
                 );
 
                 return false;
             }
 
-            item_free(n->value);
+            data[index] = key->data_copy;
+            sizes[index] = key->size;
+        }
 
-            n->value = tmp;
+        generate_hashes(m, batch, data, sizes, hashes);
 
-            return true;
-        }
+        for (size_t index = 0; index < batch; ++index){
+            if (!set_node(m, &keys[start + index], &values[start + index], hashes[index])){
+                log_write(
+                    logger,
+                    LOG_ERROR,
+                    "[%s] map_set_many() - set_node call failed\n",
+                    __FILE__
+                );
 
-        index = generate_index(index, m->size);
-        n = m->nodes[index];
+                return false;
+            }
+        }
     }
 
-    n = node_init(key, value);
+    return true;
+}
 
-    if (!n){
+size_t map_get_many(const map *m, size_t count, const size_t *sizes, const void *const *keys, map_item *values){
+    if (!m){
         log_write(
             logger,
-            LOG_ERROR,
-            "[%s] map_set() - node initialization failed\n",
+            LOG_WARNING,
+            "[%s] map_get_many() - map is NULL\n",
             __FILE__
         );
 
-        return false;
+        return 0;
+    }
+    else if (count && (!sizes || !keys || !values)){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] map_get_many() - sizes, keys or values is NULL\n",
+            __FILE__
+        );
+
+        return 0;
     }
 
-    n->hash = hash;
-    m->nodes[index] = n;
+    uint64_t hashes[MAP_BATCH_SIZE];
+    size_t found = 0;
 
-    ++m->length;
+    for (size_t start = 0; start < count; start += MAP_BATCH_SIZE){
+        size_t batch = count - start < MAP_BATCH_SIZE ? count - start : MAP_BATCH_SIZE;
 
-    if (m->first){
-        n->prev = m->last;
-        m->last->next = n;
-        m->last = n;
-    }
-    else {
-        m->first = n;
-        m->last = n;
+        for (size_t index = 0; index < batch; ++index){
+            if (!keys[start + index]){
+                log_write(
+                    logger,
+                    LOG_WARNING,
+                    "[%s] map_get_many() - key is NULL\n",
+                    __FILE__
+                );
+
+                return 0;
+            }
+        }
+
+        generate_hashes(m, batch, keys + start, sizes + start, hashes);
+
+        for (size_t index = 0; index < batch; ++index){
+            map_item *value = &values[start + index];
+            size_t nodeindex;
+
+            if (find_node(m, hashes[index], sizes[start + index], keys[start + index], &nodeindex)){
+                *value = *m->nodes[nodeindex]->value;
+
+                ++found;
+            }
+            else {
+                *value = (map_item){ .type = M_TYPE_RESERVED_EMPTY };
+            }
+        }
     }
 
-    return true;
+    return found;
 }
 
 void map_pop(map *m, size_t size, const void *key, map_item *value){
@@ -2,6 +2,7 @@
 #define MAP_H
 
 #include "list.h"
+#include "strview.h"
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -10,6 +11,11 @@
 typedef struct list list;
 typedef struct node node;
 
+/*
+ * M_TYPE_ATOM is an interned string (see intern.h) -- stored
+ * by pointer, never copied or freed, and otherwise treated
+ * like a string (its size is the string's length)
+ */
 typedef enum {
     M_TYPE_BOOL,
     M_TYPE_CHAR,
@@ -24,7 +30,10 @@ typedef enum {
     M_TYPE_STRING,
 
     M_TYPE_RESERVED_ERROR,
-    M_TYPE_RESERVED_EMPTY
+    M_TYPE_RESERVED_EMPTY,
+
+    /* after the reserved values so the rest still match ltype */
+    M_TYPE_ATOM
 } mtype;
 
 typedef void (*map_generic_free)(void *);
@@ -37,8 +46,21 @@ typedef struct map_item {
     map_generic_free generic_free;
 } map_item;
 
+/*
+ * custom key hashing -- keys that compare equal must hash
+ * the same. the hasher is given the map's seed and all 64 bits
+ * of its result are kept per node (the default is xxh3_hash64),
+ * so large maps don't fall back to comparing keys on 32 bit
+ * collisions
+ */
+typedef uint64_t (*map_hasher)(const void *, size_t, uint64_t);
+typedef bool (*map_key_equal)(const void *, size_t, const void *, size_t);
+
 typedef struct map {
-    uint32_t seed;
+    uint64_t seed;
+
+    map_hasher hasher;
+    map_key_equal key_equal;
 
     node **nodes;
     size_t length;
@@ -57,6 +79,9 @@ map *map_init(void);
 map *map_copy(const map *);
 bool map_resize(map *, size_t);
 
+/* only while the map is empty -- NULL restores the default */
+bool map_set_hasher(map *, map_hasher, map_key_equal);
+
 size_t map_get_length(const map *);
 size_t map_get_size(const map *);
 /* const char *map_to_string(const map *); */
@@ -78,6 +103,9 @@ int64_t map_get_int(const map *, size_t, const void *);
 uint64_t map_get_uint(const map *, size_t, const void *);
 size_t map_get_size_t(const map *, size_t, const void *);
 
+/* view of a string (or atom) value -- valid until the key is removed */
+string_view map_get_view(const map *, size_t, const void *);
+
 /* ------------------ WARNING ------------------
  * the data at these pointers can be modified but
  * the pointer MUST NOT be free'd! the size of the
@@ -91,6 +119,18 @@ map *map_get_map(const map *, size_t, const void *);
 void *map_get_generic(const map *, size_t, const void *);
 
 bool map_set(map *, const map_item *, const map_item *);
+bool map_set_view(map *, string_view, string_view);
+
+/*
+ * bulk map_set / lookup -- keys are hashed a batch at a time
+ * (several per vector with the default hasher) before any
+ * probing. set stops at the first failure, leaving the keys
+ * before it set. get fills each value like map_iter_get_value
+ * (M_TYPE_RESERVED_EMPTY when the key is missing) and returns
+ * how many were found
+ */
+bool map_set_many(map *, const map_item *, const map_item *, size_t);
+size_t map_get_many(const map *, size_t, const size_t *, const void *const *, map_item *);
 
 void map_pop(map *, size_t, const void *, map_item *);
 void map_remove(map *, size_t, const void *);
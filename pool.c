@@ -0,0 +1,242 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "pool.h"
+
+#include "log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static logctx *logger = NULL;
+
+/* the pool whose task this thread is running, if any */
+static _Thread_local threadpool *running = NULL;
+
+/* called with pool->lock held */
+static void run_tasks(threadpool *pool){
+    while (pool->next < pool->tasks){
+        size_t index = pool->next++;
+        threadpool_task task = pool->task;
+        void *ctx = pool->ctx;
+
+        pthread_mutex_unlock(&pool->lock);
+
+        threadpool *outer = running;
+
+        running = pool;
+
+        task(index, ctx);
+
+        running = outer;
+
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0){
+            pthread_cond_broadcast(&pool->done);
+        }
+    }
+}
+
+static void *worker(void *arg){
+    threadpool *pool = arg;
+    size_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;){
+        while (!pool->stop && pool->generation == seen){
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+
+        if (pool->stop){
+            break;
+        }
+
+        seen = pool->generation;
+
+        run_tasks(pool);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+static void stop_workers(threadpool *pool, size_t count){
+    pthread_mutex_lock(&pool->lock);
+
+    pool->stop = true;
+
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t index = 0; index < count; ++index){
+        pthread_join(pool->threads[index], NULL);
+    }
+}
+
+threadpool *threadpool_init(size_t size){
+    if (size == 0){
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+        size = online > 0 ? online : 1;
+    }
+
+    threadpool *pool = calloc(1, sizeof(*pool));
+
+    if (!pool){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] threadpool_init() - pool object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    pool->threads = calloc(size, sizeof(*pool->threads));
+
+    if (!pool->threads){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] threadpool_init() - threads alloc failed\n",
+            __FILE__
+        );
+
+        free(pool);
+
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->run, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    pool->size = size;
+
+    for (size_t index = 0; index < size; ++index){
+        if (pthread_create(&pool->threads[index], NULL, worker, pool)){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] threadpool_init() - pthread_create call failed\n",
+                __FILE__
+            );
+
+            stop_workers(pool, index);
+
+            pool->size = 0;
+
+            threadpool_free(pool);
+
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+size_t threadpool_get_size(const threadpool *pool){
+    if (!pool){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] threadpool_get_size() - pool is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return pool->size;
+}
+
+bool threadpool_run(threadpool *pool, size_t tasks, threadpool_task task, void *ctx){
+    if (!pool){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] threadpool_run() - pool is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!task){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] threadpool_run() - task is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!tasks){
+        return true;
+    }
+
+    /* called from one of this pool's tasks -- waiting for the workers would deadlock */
+    if (running == pool){
+        for (size_t index = 0; index < tasks; ++index){
+            task(index, ctx);
+        }
+
+        return true;
+    }
+
+    pthread_mutex_lock(&pool->run);
+    pthread_mutex_lock(&pool->lock);
+
+    pool->task = task;
+    pool->ctx = ctx;
+    pool->tasks = tasks;
+    pool->next = 0;
+    pool->pending = tasks;
+
+    ++pool->generation;
+
+    pthread_cond_broadcast(&pool->wake);
+
+    /* the caller works through the batch as well */
+    run_tasks(pool);
+
+    while (pool->pending){
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+
+    pool->task = NULL;
+    pool->ctx = NULL;
+
+    pthread_mutex_unlock(&pool->lock);
+    pthread_mutex_unlock(&pool->run);
+
+    return true;
+}
+
+void threadpool_free(threadpool *pool){
+    if (!pool){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] threadpool_free() - pool is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    stop_workers(pool, pool->size);
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->run);
+
+    free(pool->threads);
+    free(pool);
+}
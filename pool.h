@@ -0,0 +1,44 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef void (*threadpool_task)(size_t, void *);
+
+/*
+ * fixed set of worker threads that run batches of indexed
+ * tasks -- threadpool_run hands out task indexes 0..n-1,
+ * helps run them on the calling thread and returns once
+ * every task has finished. batches run one at a time, so a
+ * task that calls threadpool_run on its own pool gets the
+ * nested batch run inline on its thread
+ */
+typedef struct threadpool {
+    pthread_t *threads;
+    size_t size;
+
+    pthread_mutex_t run;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+
+    threadpool_task task;
+    void *ctx;
+    size_t tasks;
+    size_t next;
+    size_t pending;
+    size_t generation;
+    bool stop;
+} threadpool;
+
+threadpool *threadpool_init(size_t);
+
+size_t threadpool_get_size(const threadpool *);
+
+bool threadpool_run(threadpool *, size_t, threadpool_task, void *);
+
+void threadpool_free(threadpool *);
+
+#endif
@@ -0,0 +1,685 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "queue.h"
+
+#include "log.h"
+#include "map.h"
+#include "str.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define QUEUE_MINIMUM_SIZE 2
+#define QUEUE_PUSH_BATCH 32
+
+static logctx *logger = NULL;
+
+static bool item_set(list_item *i, const list_item *item){
+    i->type = item->type;
+    i->size = item->size;
+    i->data_copy = NULL;
+    i->generic_free = item->generic_free;
+
+    if (item->data){
+        i->data = item->data;
+
+        return true;
+    }
+
+    const void *data = item->data_copy;
+
+    if (item->type == L_TYPE_LIST){
+        i->data = list_copy(data);
+    }
+    else if (item->type == L_TYPE_MAP){
+        i->data = map_copy(data);
+    }
+    else if (item->type == L_TYPE_NULL){
+        i->data = NULL;
+
+        return true;
+    }
+    else if (item->type == L_TYPE_STRING){
+        i->data = malloc(item->size + 1);
+
+        if (i->data){
+            memcpy(i->data, data, item->size);
+
+            ((char *)i->data)[item->size] = '\0';
+        }
+    }
+    else {
+        i->data = malloc(item->size);
+
+        if (i->data){
+            memcpy(i->data, data, item->size);
+        }
+    }
+
+    if (!i->data){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] item_set() - item data initialization failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+static void item_clear(list_item *i){
+    switch (i->type){
+    case L_TYPE_GENERIC:
+        if (i->generic_free){
+            i->generic_free(i->data);
+        }
+        else {
+            free(i->data);
+        }
+
+        break;
+    case L_TYPE_LIST:
+        list_free(i->data);
+
+        break;
+    case L_TYPE_MAP:
+        map_free(i->data);
+
+        break;
+    case L_TYPE_NULL:
+        break;
+    default:
+        free(i->data);
+    }
+
+    i->data = NULL;
+}
+
+/* drops a prepared item that never made it into the queue */
+static void item_release(list_item *i, const list_item *item){
+    if (!item->data){
+        item_clear(i);
+    }
+}
+
+/*
+ * claims up to count consecutive free cells starting at head.
+ * a cell at position pos is free when its sequence equals pos
+ * and can only stop being free once head moves past it, so a
+ * successful CAS means every counted cell is ours
+ */
+static size_t claim_push(queue *q, size_t count, size_t *pos){
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+    for (;;){
+        size_t claimed = 0;
+
+        while (claimed < count){
+            queue_cell *cell = &q->cells[(head + claimed) & q->mask];
+            size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+
+            if (sequence != head + claimed){
+                break;
+            }
+
+            ++claimed;
+        }
+
+        if (!claimed){
+            queue_cell *cell = &q->cells[head & q->mask];
+            size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+
+            /* the cell still holds an item from the previous lap */
+            if ((intptr_t)(sequence - head) < 0){
+                return 0;
+            }
+
+            head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&q->head, &head, head + claimed, memory_order_relaxed, memory_order_relaxed)){
+            *pos = head;
+
+            return claimed;
+        }
+    }
+}
+
+/* same as claim_push -- a cell is ready once its sequence is pos + 1 */
+static size_t claim_pop(queue *q, size_t count, size_t *pos){
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+    for (;;){
+        size_t claimed = 0;
+
+        while (claimed < count){
+            queue_cell *cell = &q->cells[(tail + claimed) & q->mask];
+            size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+
+            if (sequence != tail + claimed + 1){
+                break;
+            }
+
+            ++claimed;
+        }
+
+        if (!claimed){
+            queue_cell *cell = &q->cells[tail & q->mask];
+            size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+
+            /* the cell has not been filled for this lap yet */
+            if ((intptr_t)(sequence - (tail + 1)) < 0){
+                return 0;
+            }
+
+            tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&q->tail, &tail, tail + claimed, memory_order_relaxed, memory_order_relaxed)){
+            *pos = tail;
+
+            return claimed;
+        }
+    }
+}
+
+static size_t push_items(queue *q, const list_item *items, size_t count){
+    size_t pushed = 0;
+
+    while (pushed < count){
+        list_item prepared[QUEUE_PUSH_BATCH];
+        size_t batch = count - pushed;
+
+        if (batch > QUEUE_PUSH_BATCH){
+            batch = QUEUE_PUSH_BATCH;
+        }
+
+        /* copies are made before claiming so cells are published quickly */
+        for (size_t index = 0; index < batch; ++index){
+            if (!item_set(&prepared[index], &items[pushed + index])){
+                for (size_t prev = 0; prev < index; ++prev){
+                    item_release(&prepared[prev], &items[pushed + prev]);
+                }
+
+                return pushed;
+            }
+        }
+
+        size_t pos = 0;
+        size_t claimed = claim_push(q, batch, &pos);
+
+        for (size_t index = 0; index < claimed; ++index){
+            queue_cell *cell = &q->cells[(pos + index) & q->mask];
+
+            cell->item = prepared[index];
+
+            atomic_store_explicit(&cell->sequence, pos + index + 1, memory_order_release);
+        }
+
+        for (size_t index = claimed; index < batch; ++index){
+            item_release(&prepared[index], &items[pushed + index]);
+        }
+
+        pushed += claimed;
+
+        if (claimed < batch){
+            break;
+        }
+    }
+
+    return pushed;
+}
+
+static size_t pop_items(queue *q, list_item *items, size_t count){
+    /* claim_pop would keep retrying a ready cell it can't take */
+    if (!count){
+        return 0;
+    }
+
+    size_t pos = 0;
+    size_t claimed = claim_pop(q, count, &pos);
+
+    for (size_t index = 0; index < claimed; ++index){
+        queue_cell *cell = &q->cells[(pos + index) & q->mask];
+
+        items[index] = cell->item;
+
+        atomic_store_explicit(&cell->sequence, pos + index + q->mask + 1, memory_order_release);
+    }
+
+    return claimed;
+}
+
+/*
+ * the fence pairs with the one in the *_wait functions: either
+ * the waiter sees the new item/slot or we see the waiter
+ */
+static void wake(queue *q, atomic_size_t *waiters, pthread_cond_t *cond, size_t count){
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (!atomic_load_explicit(waiters, memory_order_relaxed)){
+        return;
+    }
+
+    pthread_mutex_lock(&q->lock);
+
+    if (count > 1){
+        pthread_cond_broadcast(cond);
+    }
+    else {
+        pthread_cond_signal(cond);
+    }
+
+    pthread_mutex_unlock(&q->lock);
+}
+
+static void get_deadline(struct timespec *deadline, long timeout){
+    clock_gettime(CLOCK_REALTIME, deadline);
+
+    deadline->tv_sec += timeout / 1000;
+    deadline->tv_nsec += (timeout % 1000) * 1000000L;
+
+    if (deadline->tv_nsec >= 1000000000L){
+        ++deadline->tv_sec;
+
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+queue *queue_init(size_t size){
+    size_t rounded = QUEUE_MINIMUM_SIZE;
+
+    while (rounded < size){
+        if (rounded << 1 <= rounded){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] queue_init() - size (%ld) too large\n",
+                __FILE__,
+                size
+            );
+
+            return NULL;
+        }
+
+        rounded <<= 1;
+    }
+
+    queue *q = aligned_alloc(QUEUE_CACHE_LINE, sizeof(*q));
+
+    if (!q){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] queue_init() - queue object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    q->cells = malloc(rounded * sizeof(*q->cells));
+
+    if (!q->cells){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] queue_init() - cells alloc failed\n",
+            __FILE__
+        );
+
+        free(q);
+
+        return NULL;
+    }
+
+    for (size_t index = 0; index < rounded; ++index){
+        atomic_init(&q->cells[index].sequence, index);
+    }
+
+    q->mask = rounded - 1;
+
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    atomic_init(&q->push_waiters, 0);
+    atomic_init(&q->pop_waiters, 0);
+    atomic_init(&q->closed, false);
+
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->notfull, NULL);
+    pthread_cond_init(&q->notempty, NULL);
+
+    return q;
+}
+
+size_t queue_get_size(const queue *q){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_get_size() - queue is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return q->mask + 1;
+}
+
+size_t queue_get_length(const queue *q){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_get_length() - queue is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+    /* tail can be read before a concurrent pop passes head */
+    if ((intptr_t)(head - tail) <= 0){
+        return 0;
+    }
+
+    return head - tail > q->mask + 1 ? q->mask + 1 : head - tail;
+}
+
+bool queue_push(queue *q, const list_item *item){
+    return queue_push_many(q, item, 1) == 1;
+}
+
+bool queue_pop(queue *q, list_item *item){
+    return queue_pop_many(q, item, 1) == 1;
+}
+
+size_t queue_push_many(queue *q, const list_item *items, size_t count){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_push_many() - queue is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+    else if (!items){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_push_many() - items is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+    else if (atomic_load_explicit(&q->closed, memory_order_relaxed)){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] queue_push_many() - queue is closed\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    size_t pushed = push_items(q, items, count);
+
+    if (pushed){
+        wake(q, &q->pop_waiters, &q->notempty, pushed);
+    }
+
+    return pushed;
+}
+
+size_t queue_pop_many(queue *q, list_item *items, size_t count){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_pop_many() - queue is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+    else if (!items){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_pop_many() - items is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    size_t popped = pop_items(q, items, count);
+
+    if (popped){
+        wake(q, &q->push_waiters, &q->notfull, popped);
+    }
+
+    return popped;
+}
+
+bool queue_push_wait(queue *q, const list_item *item, long timeout){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_push_wait() - queue is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!item){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_push_wait() - item is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (queue_push(q, item)){
+        return true;
+    }
+    else if (atomic_load(&q->closed)){
+        return false;
+    }
+
+    struct timespec deadline;
+
+    if (timeout >= 0){
+        get_deadline(&deadline, timeout);
+    }
+
+    bool success = false;
+
+    pthread_mutex_lock(&q->lock);
+
+    atomic_fetch_add(&q->push_waiters, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    for (;;){
+        if (atomic_load(&q->closed)){
+            break;
+        }
+
+        if ((success = push_items(q, item, 1) == 1)){
+            break;
+        }
+
+        if (timeout < 0){
+            pthread_cond_wait(&q->notfull, &q->lock);
+        }
+        else if (pthread_cond_timedwait(&q->notfull, &q->lock, &deadline) == ETIMEDOUT){
+            success = !atomic_load(&q->closed) && push_items(q, item, 1) == 1;
+
+            break;
+        }
+    }
+
+    atomic_fetch_sub(&q->push_waiters, 1);
+
+    pthread_mutex_unlock(&q->lock);
+
+    if (success){
+        wake(q, &q->pop_waiters, &q->notempty, 1);
+    }
+
+    return success;
+}
+
+bool queue_pop_wait(queue *q, list_item *item, long timeout){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_pop_wait() - queue is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!item){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_pop_wait() - item is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (queue_pop(q, item)){
+        return true;
+    }
+
+    struct timespec deadline;
+
+    if (timeout >= 0){
+        get_deadline(&deadline, timeout);
+    }
+
+    bool success = false;
+
+    pthread_mutex_lock(&q->lock);
+
+    atomic_fetch_add(&q->pop_waiters, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    for (;;){
+        if ((success = pop_items(q, item, 1) == 1)){
+            break;
+        }
+
+        /* producers are done once closed -- nothing more will arrive */
+        if (atomic_load(&q->closed)){
+            break;
+        }
+
+        if (timeout < 0){
+            pthread_cond_wait(&q->notempty, &q->lock);
+        }
+        else if (pthread_cond_timedwait(&q->notempty, &q->lock, &deadline) == ETIMEDOUT){
+            success = pop_items(q, item, 1) == 1;
+
+            break;
+        }
+    }
+
+    atomic_fetch_sub(&q->pop_waiters, 1);
+
+    pthread_mutex_unlock(&q->lock);
+
+    if (success){
+        wake(q, &q->push_waiters, &q->notfull, 1);
+    }
+
+    return success;
+}
+
+void queue_close(queue *q){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_close() - queue is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    pthread_mutex_lock(&q->lock);
+
+    atomic_store(&q->closed, true);
+
+    pthread_cond_broadcast(&q->notfull);
+    pthread_cond_broadcast(&q->notempty);
+    pthread_mutex_unlock(&q->lock);
+}
+
+bool queue_is_closed(const queue *q){
+    if (!q){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] queue_is_closed() - queue is NULL\n",
+            __FILE__
+        );
+
+        return true;
+    }
+
+    return atomic_load(&q->closed);
+}
+
+void queue_free(queue *q){
+    if (!q){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] queue_free() - queue is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    list_item item;
+
+    while (pop_items(q, &item, 1)){
+        item_clear(&item);
+    }
+
+    pthread_cond_destroy(&q->notempty);
+    pthread_cond_destroy(&q->notfull);
+    pthread_mutex_destroy(&q->lock);
+
+    free(q->cells);
+    free(q);
+}
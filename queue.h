@@ -0,0 +1,75 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "list.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define QUEUE_CACHE_LINE 64
+
+/*
+ * bounded multi-producer multi-consumer queue -- a ring of
+ * sequence numbered cells where producers and consumers
+ * claim positions with a CAS and never take a lock.
+ *
+ * items follow the list_append model (data is taken,
+ * data_copy is copied) and popping hands the payload over
+ * to the caller the same way list_pop does
+ */
+typedef struct queue_cell {
+    atomic_size_t sequence;
+    list_item item;
+} queue_cell;
+
+typedef struct queue {
+    queue_cell *cells;
+    size_t mask;
+
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t head;
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t tail;
+
+    /* only touched by the *_wait functions and their wakeups */
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t push_waiters;
+    atomic_size_t pop_waiters;
+    atomic_bool closed;
+
+    pthread_mutex_t lock;
+    pthread_cond_t notfull;
+    pthread_cond_t notempty;
+} queue;
+
+/* size is rounded up to a power of 2 */
+queue *queue_init(size_t);
+
+size_t queue_get_size(const queue *);
+
+/* a snapshot -- may be stale by the time it returns */
+size_t queue_get_length(const queue *);
+
+/* non-blocking -- false when the queue is full or empty */
+bool queue_push(queue *, const list_item *);
+bool queue_pop(queue *, list_item *);
+
+/* return the number of items pushed or popped (in order) */
+size_t queue_push_many(queue *, const list_item *, size_t);
+size_t queue_pop_many(queue *, list_item *, size_t);
+
+/*
+ * block until there is room or an item, the timeout (in
+ * milliseconds, negative waits forever) expires or the
+ * queue is closed. popping still drains a closed queue
+ */
+bool queue_push_wait(queue *, const list_item *, long);
+bool queue_pop_wait(queue *, list_item *, long);
+
+/* wakes every waiter and makes further pushes fail */
+void queue_close(queue *);
+bool queue_is_closed(const queue *);
+
+/* NOT safe while other threads use the queue */
+void queue_free(queue *);
+
+#endif
@@ -2,27 +2,133 @@
 #define STR_H
 
 #include "list.h"
+#include "strview.h"
 
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 #include <time.h>
 
 char *string_create(const char *, ...);
 bool string_copy(const char *, char *, size_t);
 char *string_duplicate(const char *);
+char *string_duplicate_len(const char *, size_t);
+
+string_view string_view_init(const char *, size_t);
+string_view string_view_from_string(const char *);
+bool string_view_equal(string_view, string_view);
+char *string_view_duplicate(string_view);
+
+/*
+ * allocation free alternative to string_split -- tokens are
+ * views into the input, which must outlive the tokenizer.
+ * count limits the number of delimiters used (negative for
+ * no limit) and the remainder is always the last token
+ */
+typedef struct str_tok {
+    string_view input;
+    string_view delim;
+    size_t offset;
+    long count;
+    bool done;
+} str_tok;
+
+bool str_tok_init(str_tok *, string_view, string_view, long);
+bool str_tok_next(str_tok *, string_view *);
+
+/*
+ * first occurrence of needle in haystack (neither needs a NUL)
+ * in worst case linear time -- an empty needle matches at 0
+ */
+const char *string_find(const char *, size_t, const char *, size_t);
 
 list *string_split_len(const char *, size_t, const char *, long);
 list *string_split(const char *, const char *, long);
+list *string_split_view(string_view, string_view, long);
 char *string_join(const list *, const char *);
 
+/* ASCII only -- bytes outside A-Z / a-z are left as they are */
 char *string_lower(char *);
 char *string_upper(char *);
+char *string_lower_n(char *, size_t);
+char *string_upper_n(char *, size_t);
+
+/* compares exactly n bytes, ignoring ASCII case (no NUL handling) */
+int string_casecmp_n(const char *, const char *, size_t);
+
+/* usable as a map_hasher / map_key_equal pair for case-insensitive keys */
+uint64_t string_hash_casefold(const void *, size_t, uint64_t);
+bool string_equal_casefold(const void *, size_t, const void *, size_t);
+
+/* buffer sizes that always fit (terminator included) */
+#define STRING_INT_SIZE 21
+#define STRING_DOUBLE_SIZE 32
+
+/*
+ * return the length written (0 when the output is too small)
+ * and NUL terminate. doubles use the shortest digits that
+ * round trip, laid out like JSON/JavaScript numbers
+ */
+size_t string_from_i64(int64_t, char *, size_t);
+size_t string_from_u64(uint64_t, char *, size_t);
+size_t string_from_double(double, char *, size_t);
 
 bool string_from_time(time_t, bool, const char *, char *, size_t);
 
 bool string_to_int(const char *, int *, int);
+
+/*
+ * length delimited and locale independent -- the whole input
+ * must be the number (no whitespace). integer overflow fails,
+ * as does a finite double that rounds to infinity
+ */
+bool string_to_i64(const char *, size_t, int64_t *);
+bool string_to_u64(const char *, size_t, uint64_t *);
+bool string_to_double(const char *, size_t, double *);
 bool string_is_numeric(const char *);
 
+/*
+ * binary <-> text codecs. base64 pads with '=' and base64url
+ * ('-' and '_') does not, decoding takes either. percent
+ * encoding escapes everything but the RFC 3986 unreserved
+ * characters and does not treat '+' as a space
+ */
+typedef enum {
+    STRING_CODEC_BASE64,
+    STRING_CODEC_BASE64_URL,
+    STRING_CODEC_HEX,
+    STRING_CODEC_PERCENT
+} string_codec_type;
+
+/* exact output lengths (no terminator) -- decoding assumes valid input */
+size_t string_encoded_length(string_codec_type, const void *, size_t);
+size_t string_decoded_length(string_codec_type, const char *, size_t);
+
+/* output size is checked against the lengths above, nothing is NUL terminated */
+bool string_encode(string_codec_type, const void *, size_t, char *, size_t, size_t *);
+bool string_decode(string_codec_type, const char *, size_t, void *, size_t, size_t *);
+
+/*
+ * chunked versions of the above -- update consumes the whole
+ * chunk and holds on to a partial group until the next call,
+ * finish flushes it (and fails if the input ended mid group)
+ */
+typedef struct string_codec {
+    string_codec_type type;
+    bool decoding;
+    bool padded;
+    uint8_t pending[4];
+    size_t pendinglength;
+} string_codec;
+
+bool string_codec_init(string_codec *, string_codec_type, bool);
+
+/* largest output of an update with a chunk this long and the finish after it */
+size_t string_codec_output_size(const string_codec *, size_t);
+
+bool string_codec_update(string_codec *, const void *, size_t, void *, size_t, size_t *);
+bool string_codec_finish(string_codec *, void *, size_t, size_t *);
+
 #endif
@@ -0,0 +1,428 @@
+#include "strbuf.h"
+
+#include "log.h"
+#include "str.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STRBUF_MINIMUM_SIZE 16
+
+static logctx *logger = NULL;
+
+/* makes room for needed more characters plus the terminator */
+static bool check_availability(strbuf *sb, size_t needed){
+    if (needed < sb->size - sb->length){
+        return true;
+    }
+
+    size_t required = sb->length + needed + 1;
+
+    if (required <= sb->length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] check_availability() - required size overflows -- unable to grow strbuf\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    size_t newsize = sb->size;
+
+    while (newsize < required){
+        if (newsize << 1 <= newsize){
+            newsize = required;
+
+            break;
+        }
+
+        newsize <<= 1;
+    }
+
+    char *data = realloc(sb->data, newsize);
+
+    if (!data){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] check_availability() - data realloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    sb->data = data;
+    sb->size = newsize;
+
+    return true;
+}
+
+strbuf *strbuf_init(size_t size){
+    if (size < STRBUF_MINIMUM_SIZE){
+        size = STRBUF_MINIMUM_SIZE;
+    }
+
+    strbuf *sb = malloc(sizeof(*sb));
+
+    if (!sb){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strbuf_init() - strbuf object alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    sb->data = malloc(size);
+
+    if (!sb->data){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strbuf_init() - data alloc failed\n",
+            __FILE__
+        );
+
+        free(sb);
+
+        return NULL;
+    }
+
+    sb->data[0] = '\0';
+    sb->length = 0;
+    sb->size = size;
+
+    return sb;
+}
+
+bool strbuf_reserve(strbuf *sb, size_t size){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_reserve() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (size <= sb->size){
+        return true;
+    }
+
+    char *data = realloc(sb->data, size);
+
+    if (!data){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strbuf_reserve() - data realloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    sb->data = data;
+    sb->size = size;
+
+    return true;
+}
+
+size_t strbuf_get_length(const strbuf *sb){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_get_length() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return sb->length;
+}
+
+size_t strbuf_get_size(const strbuf *sb){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_get_size() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return sb->size;
+}
+
+const char *strbuf_get_string(const strbuf *sb){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_get_string() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    return sb->data;
+}
+
+string_view strbuf_get_view(const strbuf *sb){
+    string_view view = {0};
+
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_get_view() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return view;
+    }
+
+    view.data = sb->data;
+    view.length = sb->length;
+
+    return view;
+}
+
+bool strbuf_append(strbuf *sb, const char *data, size_t size){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_append() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!data && size){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_append() - data is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    /* appending part of the buffer itself -- growing it would move the source */
+    uintptr_t start = (uintptr_t)sb->data;
+    bool inside = (uintptr_t)data >= start && (uintptr_t)data < start + sb->size;
+    size_t offset = (uintptr_t)data - start;
+
+    if (!check_availability(sb, size)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strbuf_append() - check_availability call failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    if (inside){
+        data = sb->data + offset;
+    }
+
+    if (size){
+        memcpy(sb->data + sb->length, data, size);
+    }
+
+    sb->length += size;
+    sb->data[sb->length] = '\0';
+
+    return true;
+}
+
+bool strbuf_append_view(strbuf *sb, string_view view){
+    return strbuf_append(sb, view.data, view.length);
+}
+
+bool strbuf_append_string(strbuf *sb, const char *string){
+    if (!string){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_append_string() - string is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return strbuf_append(sb, string, strlen(string));
+}
+
+bool strbuf_append_char(strbuf *sb, char c){
+    return strbuf_append(sb, &c, 1);
+}
+
+bool strbuf_append_uint(strbuf *sb, uint64_t value){
+    char digits[STRING_INT_SIZE];
+    size_t length = string_from_u64(value, digits, sizeof(digits));
+
+    return strbuf_append(sb, digits, length);
+}
+
+bool strbuf_append_int(strbuf *sb, int64_t value){
+    char digits[STRING_INT_SIZE];
+    size_t length = string_from_i64(value, digits, sizeof(digits));
+
+    return strbuf_append(sb, digits, length);
+}
+
+bool strbuf_append_double(strbuf *sb, double value){
+    char digits[STRING_DOUBLE_SIZE];
+    size_t length = string_from_double(value, digits, sizeof(digits));
+
+    return strbuf_append(sb, digits, length);
+}
+
+bool strbuf_appendf(strbuf *sb, const char *format, ...){
+    va_list args;
+
+    va_start(args, format);
+
+    bool success = strbuf_vappendf(sb, format, args);
+
+    va_end(args);
+
+    return success;
+}
+
+bool strbuf_vappendf(strbuf *sb, const char *format, va_list args){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_vappendf() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+    else if (!format){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_vappendf() - format is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    va_list argscpy;
+
+    va_copy(argscpy, args);
+
+    /* format straight into the spare capacity first */
+    size_t spare = sb->size - sb->length;
+    int written = vsnprintf(sb->data + sb->length, spare, format, argscpy);
+
+    va_end(argscpy);
+
+    if (written < 0){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strbuf_vappendf() - vsnprintf call failed\n",
+            __FILE__
+        );
+
+        sb->data[sb->length] = '\0';
+
+        return false;
+    }
+
+    if ((size_t)written >= spare){
+        /* only a second pass when the output did not fit */
+        if (!check_availability(sb, written)){
+            log_write(
+                logger,
+                LOG_ERROR,
+                "[%s] strbuf_vappendf() - check_availability call failed\n",
+                __FILE__
+            );
+
+            sb->data[sb->length] = '\0';
+
+            return false;
+        }
+
+        vsnprintf(sb->data + sb->length, sb->size - sb->length, format, args);
+    }
+
+    sb->length += written;
+
+    return true;
+}
+
+void strbuf_clear(strbuf *sb){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_clear() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    sb->length = 0;
+    sb->data[0] = '\0';
+}
+
+char *strbuf_detach(strbuf *sb){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strbuf_detach() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    char *data = sb->data;
+
+    free(sb);
+
+    return data;
+}
+
+void strbuf_free(strbuf *sb){
+    if (!sb){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] strbuf_free() - strbuf is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    free(sb->data);
+    free(sb);
+}
@@ -0,0 +1,56 @@
+#ifndef STRBUF_H
+#define STRBUF_H
+
+#include "strview.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * growable string -- capacity doubles as needed so appends
+ * are amortized O(1). data is always NUL terminated and
+ * size counts the terminator
+ */
+typedef struct strbuf {
+    char *data;
+    size_t length;
+    size_t size;
+} strbuf;
+
+strbuf *strbuf_init(size_t);
+bool strbuf_reserve(strbuf *, size_t);
+
+size_t strbuf_get_length(const strbuf *);
+size_t strbuf_get_size(const strbuf *);
+
+/* valid until the next append */
+const char *strbuf_get_string(const strbuf *);
+string_view strbuf_get_view(const strbuf *);
+
+/* the source may point into the strbuf's own data */
+bool strbuf_append(strbuf *, const char *, size_t);
+bool strbuf_append_view(strbuf *, string_view);
+bool strbuf_append_string(strbuf *, const char *);
+
+bool strbuf_append_char(strbuf *, char);
+bool strbuf_append_int(strbuf *, int64_t);
+bool strbuf_append_uint(strbuf *, uint64_t);
+bool strbuf_append_double(strbuf *, double);
+
+/*
+ * neither the format nor any argument may point into the
+ * strbuf's own data -- it is written to and may be reallocated
+ * while the arguments are still being read
+ */
+bool strbuf_appendf(strbuf *, const char *, ...);
+bool strbuf_vappendf(strbuf *, const char *, va_list);
+
+void strbuf_clear(strbuf *);
+
+/* hands over the string (free it) and frees the strbuf itself */
+char *strbuf_detach(strbuf *);
+void strbuf_free(strbuf *);
+
+#endif
@@ -0,0 +1,378 @@
+#include "strmatch.h"
+
+#include "log.h"
+#include "strview.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static logctx *logger = NULL;
+
+typedef struct strmatch_first {
+    size_t pattern;
+    size_t offset;
+    bool found;
+} strmatch_first;
+
+static bool check_patterns(const list *patterns, size_t *total){
+    size_t length = list_get_length(patterns);
+
+    *total = 1;
+
+    for (size_t index = 0; index < length; ++index){
+        if (list_get_type(patterns, index) != L_TYPE_STRING){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] check_patterns() - pattern is not a string\n",
+                __FILE__
+            );
+
+            return false;
+        }
+
+        string_view pattern = list_get_view(patterns, index);
+
+        if (!pattern.length){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] check_patterns() - pattern is empty\n",
+                __FILE__
+            );
+
+            return false;
+        }
+        else if (pattern.length >= UINT32_MAX - *total){
+            log_write(
+                logger,
+                LOG_WARNING,
+                "[%s] check_patterns() - patterns are too long\n",
+                __FILE__
+            );
+
+            return false;
+        }
+
+        *total += pattern.length;
+    }
+
+    return true;
+}
+
+static void set_classes(strmatch *m, const list *patterns){
+    bool seen[256] = {0};
+
+    for (size_t index = 0; index < m->patterns; ++index){
+        string_view pattern = list_get_view(patterns, index);
+
+        for (size_t pos = 0; pos < pattern.length; ++pos){
+            seen[(uint8_t)pattern.data[pos]] = true;
+        }
+    }
+
+    /* class 0 is every byte that no pattern uses */
+    m->classcount = 1;
+
+    for (size_t byte = 0; byte < 256; ++byte){
+        m->classes[byte] = seen[byte] ? (uint8_t)m->classcount++ : 0;
+    }
+}
+
+/*
+ * builds the trie in the transition table where 0 means no
+ * edge yet (nothing in a trie points back at the root)
+ */
+static void add_patterns(strmatch *m, const list *patterns){
+    m->states = 1;
+
+    for (size_t index = 0; index < m->patterns; ++index){
+        string_view pattern = list_get_view(patterns, index);
+        uint32_t state = 0;
+
+        m->lengths[index] = pattern.length;
+
+        for (size_t pos = 0; pos < pattern.length; ++pos){
+            uint32_t *next = &m->transitions[
+                state * m->classcount + m->classes[(uint8_t)pattern.data[pos]]
+            ];
+
+            if (!*next){
+                *next = (uint32_t)m->states++;
+            }
+
+            state = *next;
+        }
+
+        if (m->outputs[state]){
+            /* same string again, chain it behind the first one */
+            size_t first = m->outputs[state] - 1;
+
+            while (m->duplicates[first]){
+                first = m->duplicates[first] - 1;
+            }
+
+            m->duplicates[first] = index + 1;
+        }
+        else {
+            m->outputs[state] = (uint32_t)index + 1;
+        }
+    }
+}
+
+/*
+ * breadth first so a state's failure state is always finished
+ * before the state itself -- the missing edges are filled in
+ * from the failure state's row which turns the trie into a dfa
+ */
+static bool add_failures(strmatch *m){
+    uint32_t *failures = calloc(m->states, sizeof(*failures));
+    uint32_t *states = malloc(m->states * sizeof(*states));
+
+    if (!failures || !states){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] add_failures() - failure initialization failed\n",
+            __FILE__
+        );
+
+        free(failures);
+        free(states);
+
+        return false;
+    }
+
+    size_t head = 0;
+    size_t tail = 0;
+
+    states[tail++] = 0;
+
+    while (head < tail){
+        uint32_t state = states[head++];
+        uint32_t failure = failures[state];
+        uint32_t *row = &m->transitions[state * m->classcount];
+        const uint32_t *fallback = &m->transitions[failure * m->classcount];
+
+        for (size_t column = 0; column < m->classcount; ++column){
+            if (!row[column]){
+                row[column] = state ? fallback[column] : 0;
+
+                continue;
+            }
+
+            uint32_t next = row[column];
+
+            failures[next] = state ? fallback[column] : 0;
+
+            /* nearest proper suffix that ends a pattern */
+            m->suffixes[next] = m->outputs[failures[next]]
+                ? failures[next]
+                : m->suffixes[failures[next]];
+
+            states[tail++] = next;
+        }
+    }
+
+    free(failures);
+    free(states);
+
+    return true;
+}
+
+strmatch *strmatch_compile(const list *patterns){
+    if (!patterns){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strmatch_compile() - patterns are NULL\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    size_t total;
+
+    if (!check_patterns(patterns, &total)){
+        return NULL;
+    }
+
+    strmatch *m = calloc(1, sizeof(*m));
+
+    if (!m){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strmatch_compile() - strmatch alloc failed\n",
+            __FILE__
+        );
+
+        return NULL;
+    }
+
+    m->patterns = list_get_length(patterns);
+
+    set_classes(m, patterns);
+
+    if (total > SIZE_MAX / sizeof(*m->transitions) / m->classcount){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strmatch_compile() - patterns are too long\n",
+            __FILE__
+        );
+
+        free(m);
+
+        return NULL;
+    }
+
+    /* sized for the worst case (no shared prefixes) then shrunk */
+    m->transitions = calloc(total * m->classcount, sizeof(*m->transitions));
+    m->outputs = calloc(total, sizeof(*m->outputs));
+    m->suffixes = calloc(total, sizeof(*m->suffixes));
+    m->lengths = calloc(m->patterns + 1, sizeof(*m->lengths));
+    m->duplicates = calloc(m->patterns + 1, sizeof(*m->duplicates));
+
+    if (!m->transitions || !m->outputs || !m->suffixes ||
+            !m->lengths || !m->duplicates){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] strmatch_compile() - table initialization failed\n",
+            __FILE__
+        );
+
+        strmatch_free(m);
+
+        return NULL;
+    }
+
+    add_patterns(m, patterns);
+
+    if (!add_failures(m)){
+        strmatch_free(m);
+
+        return NULL;
+    }
+
+    uint32_t *transitions = realloc(
+        m->transitions,
+        m->states * m->classcount * sizeof(*transitions)
+    );
+
+    if (transitions){
+        m->transitions = transitions;
+    }
+
+    return m;
+}
+
+size_t strmatch_get_length(const strmatch *m){
+    if (!m){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strmatch_get_length() - strmatch is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    return m->patterns;
+}
+
+size_t strmatch_scan(const strmatch *m, const char *input, size_t inputlen, strmatch_fn fn, void *ctx){
+    if (!m || (!input && inputlen) || !fn){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] strmatch_scan() - invalid arguments\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)input;
+    const uint32_t *transitions = m->transitions;
+    size_t classcount = m->classcount;
+    size_t count = 0;
+    uint32_t state = 0;
+
+    for (size_t pos = 0; pos < inputlen; ++pos){
+        state = transitions[state * classcount + m->classes[bytes[pos]]];
+
+        uint32_t match = m->outputs[state] ? state : m->suffixes[state];
+
+        while (match){
+            size_t pattern = m->outputs[match];
+
+            while (pattern){
+                count++;
+
+                if (!fn(pattern - 1, pos + 1 - m->lengths[pattern - 1], ctx)){
+                    return count;
+                }
+
+                pattern = m->duplicates[pattern - 1];
+            }
+
+            match = m->suffixes[match];
+        }
+    }
+
+    return count;
+}
+
+static bool find_first(size_t pattern, size_t offset, void *ctx){
+    strmatch_first *first = ctx;
+
+    first->pattern = pattern;
+    first->offset = offset;
+    first->found = true;
+
+    return false;
+}
+
+bool strmatch_find(const strmatch *m, const char *input, size_t inputlen, size_t *pattern, size_t *offset){
+    strmatch_first first = {0};
+
+    strmatch_scan(m, input, inputlen, find_first, &first);
+
+    if (!first.found){
+        return false;
+    }
+
+    if (pattern){
+        *pattern = first.pattern;
+    }
+
+    if (offset){
+        *offset = first.offset;
+    }
+
+    return true;
+}
+
+void strmatch_free(strmatch *m){
+    if (!m){
+        log_write(
+            logger,
+            LOG_DEBUG,
+            "[%s] strmatch_free() - strmatch is NULL\n",
+            __FILE__
+        );
+
+        return;
+    }
+
+    free(m->transitions);
+    free(m->outputs);
+    free(m->suffixes);
+    free(m->lengths);
+    free(m->duplicates);
+    free(m);
+}
@@ -0,0 +1,55 @@
+#ifndef STRMATCH_H
+#define STRMATCH_H
+
+#include "list.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * called for every match with the pattern index (position in
+ * the compiled list) and the offset the match starts at --
+ * return false to stop scanning
+ */
+typedef bool (*strmatch_fn)(size_t, size_t, void *);
+
+/*
+ * Aho-Corasick automaton compiled into a full transition table
+ * over byte classes (bytes that appear in no pattern share one
+ * class) so scanning is one table lookup per input byte no
+ * matter how many patterns there are. read only once compiled
+ * so it can be shared between threads
+ */
+typedef struct strmatch {
+    uint8_t classes[256];
+    size_t classcount;
+
+    uint32_t *transitions;
+    uint32_t *outputs;
+    uint32_t *suffixes;
+    size_t states;
+
+    size_t *lengths;
+    size_t *duplicates;
+    size_t patterns;
+} strmatch;
+
+/* patterns are L_TYPE_STRING items and may not be empty */
+strmatch *strmatch_compile(const list *);
+
+size_t strmatch_get_length(const strmatch *);
+
+/*
+ * matches are reported in the order they end, longest first
+ * when several end at the same byte. returns the number of
+ * matches reported
+ */
+size_t strmatch_scan(const strmatch *, const char *, size_t, strmatch_fn, void *);
+
+/* the first match to end -- sets the pattern index and offset */
+bool strmatch_find(const strmatch *, const char *, size_t, size_t *, size_t *);
+
+void strmatch_free(strmatch *);
+
+#endif
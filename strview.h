@@ -0,0 +1,16 @@
+#ifndef STRVIEW_H
+#define STRVIEW_H
+
+#include <stddef.h>
+
+/*
+ * non-owning (pointer, length) pair -- the bytes are not
+ * required to be NUL terminated and are never scanned for
+ * one. the pointed to data must outlive the view
+ */
+typedef struct string_view {
+    const char *data;
+    size_t length;
+} string_view;
+
+#endif
@@ -0,0 +1,223 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "treehash.h"
+
+#include "log.h"
+#include "pool.h"
+
+#include "hashers/xxh3.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* leaves, inner nodes and the root are hashed under different seeds */
+#define TREEHASH_NODE_KEY 0x9e3779b97f4a7c15ULL
+#define TREEHASH_ROOT_KEY 0xc2b2ae3d27d4eb4fULL
+
+static logctx *logger = NULL;
+
+typedef struct treetask {
+    const unsigned char *data;
+    size_t length;
+    uint64_t seed;
+    uint64_t *nodes;
+} treetask;
+
+static void hash_leaf(size_t index, void *ctx){
+    treetask *task = ctx;
+    size_t offset = index * TREEHASH_BLOCK_SIZE;
+    size_t length = task->length - offset;
+
+    if (length > TREEHASH_BLOCK_SIZE){
+        length = TREEHASH_BLOCK_SIZE;
+    }
+
+    xxh3_hash128(
+        task->data + offset,
+        length,
+        task->seed,
+        &task->nodes[2 * index],
+        &task->nodes[2 * index + 1]
+    );
+}
+
+/* folds the leaves in place, one level at a time, down to the root */
+static void combine(uint64_t *nodes, size_t count, uint64_t seed){
+    while (count > 1){
+        size_t pairs = count / 2;
+
+        for (size_t index = 0; index < pairs; ++index){
+            uint64_t pair[4] = {
+                nodes[4 * index], nodes[4 * index + 1],
+                nodes[4 * index + 2], nodes[4 * index + 3]
+            };
+
+            xxh3_hash128(pair, sizeof(pair), seed ^ TREEHASH_NODE_KEY, &nodes[2 * index], &nodes[2 * index + 1]);
+        }
+
+        if (count & 1){
+            nodes[2 * pairs] = nodes[2 * (count - 1)];
+            nodes[2 * pairs + 1] = nodes[2 * (count - 1) + 1];
+        }
+
+        count = pairs + (count & 1);
+    }
+}
+
+bool hash_tree(threadpool *pool, const void *data, size_t length, uint64_t seed, uint64_t *low, uint64_t *high){
+    if (!data && length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] hash_tree() - data is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    /* an empty input is a single empty leaf */
+    size_t count = length ? (length - 1) / TREEHASH_BLOCK_SIZE + 1 : 1;
+    uint64_t *nodes = calloc(count, 2 * sizeof(*nodes));
+
+    if (!nodes){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] hash_tree() - nodes alloc failed\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    treetask task = {
+        .data = data ? data : (const void *)"",
+        .length = length,
+        .seed = seed,
+        .nodes = nodes
+    };
+
+    if (!pool || count == 1){
+        for (size_t index = 0; index < count; ++index){
+            hash_leaf(index, &task);
+        }
+    }
+    else if (!threadpool_run(pool, count, hash_leaf, &task)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] hash_tree() - threadpool_run call failed\n",
+            __FILE__
+        );
+
+        free(nodes);
+
+        return false;
+    }
+
+    combine(nodes, count, seed);
+
+    uint64_t root[3] = { nodes[0], nodes[1], (uint64_t)length };
+
+    xxh3_hash128(root, sizeof(root), seed ^ TREEHASH_ROOT_KEY, low, high);
+
+    free(nodes);
+
+    return true;
+}
+
+bool hash_file(threadpool *pool, const char *path, uint64_t *low, uint64_t *high){
+    if (!path){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] hash_file() - path is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] hash_file() - unable to open %s\n",
+            __FILE__,
+            path
+        );
+
+        return false;
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) || !S_ISREG(info.st_mode)){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] hash_file() - %s is not a regular file\n",
+            __FILE__,
+            path
+        );
+
+        close(fd);
+
+        return false;
+    }
+    else if ((uintmax_t)info.st_size > SIZE_MAX){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] hash_file() - %s is too large to map\n",
+            __FILE__,
+            path
+        );
+
+        close(fd);
+
+        return false;
+    }
+
+    size_t length = (size_t)info.st_size;
+
+    /* mmap refuses empty mappings */
+    if (!length){
+        close(fd);
+
+        return hash_tree(pool, NULL, 0, 0, low, high);
+    }
+
+    void *data = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (data == MAP_FAILED){
+        log_write(
+            logger,
+            LOG_ERROR,
+            "[%s] hash_file() - mmap call failed for %s\n",
+            __FILE__,
+            path
+        );
+
+        return false;
+    }
+
+    /* the workers fault in blocks out of order, so ask for all of it */
+    posix_madvise(data, length, POSIX_MADV_WILLNEED);
+
+    bool success = hash_tree(pool, data, length, 0, low, high);
+
+    munmap(data, length);
+
+    return success;
+}
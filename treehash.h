@@ -0,0 +1,27 @@
+#ifndef TREEHASH_H
+#define TREEHASH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TREEHASH_BLOCK_SIZE (1 << 20)
+
+typedef struct threadpool threadpool;
+
+/*
+ * 128 bit fingerprint of large inputs, hashed in parallel.
+ * the input is cut into TREEHASH_BLOCK_SIZE blocks whose
+ * xxh3_hash128 leaves are hashed on the pool (or the calling
+ * thread when the pool is NULL), then pairs of nodes are
+ * combined left to right, level by level -- an odd node out
+ * moves up unchanged -- and the root is finished with the
+ * total length. the result only depends on the input and the
+ * seed, never on the number of threads
+ */
+bool hash_tree(threadpool *, const void *, size_t, uint64_t, uint64_t *, uint64_t *);
+
+/* hash_tree of a regular file (mapped, not read), seed 0 */
+bool hash_file(threadpool *, const char *, uint64_t *, uint64_t *);
+
+#endif
@@ -0,0 +1,655 @@
+#include "utf8.h"
+
+#include "cpu.h"
+#include "log.h"
+
+#include <stdatomic.h>
+#include <string.h>
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * error bits for the lookup validator (Keiser & Lemire) -- each
+ * table maps a nibble of the previous or current byte to the
+ * errors it could be part of, a pair of bytes is only invalid
+ * when all three lookups agree on a bit
+ */
+#define UTF8_TOO_SHORT (1 << 0)
+#define UTF8_TOO_LONG (1 << 1)
+#define UTF8_OVERLONG_3 (1 << 2)
+#define UTF8_TOO_LARGE (1 << 3)
+#define UTF8_SURROGATE (1 << 4)
+#define UTF8_OVERLONG_2 (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4 (1 << 6)
+#define UTF8_TWO_CONTINUATIONS (1 << 7)
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTINUATIONS)
+
+typedef bool (*utf8_validator)(const uint8_t *, size_t);
+
+static logctx *logger = NULL;
+
+#ifdef CPU_X86
+static const uint8_t first_high[16] = {
+    /* 0_______ ascii */
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    /* 10______ continuation */
+    UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS,
+    UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS,
+    /* 1100____ and 1101____ two byte leads */
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    /* 1110____ three byte lead */
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    /* 1111____ four byte lead */
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+};
+
+static const uint8_t first_low[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    /* ____1101 is 0xED, the lead of the surrogates */
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+};
+
+static const uint8_t second_high[16] = {
+    /* 0_______ ascii */
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    /* 1000____ */
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    /* 1001____ */
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    /* 101_____ */
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_SURROGATE | UTF8_TOO_LARGE,
+    /* 11______ leads */
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+};
+
+/* the last three bytes of a block may start an unfinished sequence */
+static const uint8_t incomplete_limits[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+#endif
+
+#ifdef CPU_X86
+typedef struct utf8_state_avx2 {
+    __m256i previous;
+    __m256i incomplete;
+    __m256i error;
+} utf8_state_avx2;
+
+__attribute__((target("avx2")))
+static __m256i lookup_32(const uint8_t *table, __m256i nibbles){
+    return _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)table)),
+        nibbles
+    );
+}
+
+__attribute__((target("avx2")))
+static void check_32(utf8_state_avx2 *state, __m256i input){
+    if (!_mm256_movemask_epi8(input)){
+        state->error = _mm256_or_si256(state->error, state->incomplete);
+
+        return;
+    }
+
+    __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i carried = _mm256_permute2x128_si256(state->previous, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, carried, 15);
+    __m256i prev2 = _mm256_alignr_epi8(input, carried, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, carried, 13);
+
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(
+            lookup_32(first_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low)),
+            lookup_32(first_low, _mm256_and_si256(prev1, low))
+        ),
+        lookup_32(second_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), low))
+    );
+
+    /* two continuations in a row are fine as the 3rd or 4th byte */
+    __m256i continued = _mm256_or_si256(
+        _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80))),
+        _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)))
+    );
+
+    continued = _mm256_and_si256(continued, _mm256_set1_epi8((char)0x80));
+
+    state->error = _mm256_or_si256(state->error, _mm256_xor_si256(continued, special));
+    state->incomplete = _mm256_subs_epu8(
+        input,
+        _mm256_loadu_si256((const __m256i *)incomplete_limits)
+    );
+    state->previous = input;
+}
+
+__attribute__((target("avx2")))
+static bool validate_avx2(const uint8_t *input, size_t length){
+    utf8_state_avx2 state = {
+        _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()
+    };
+    size_t pos = 0;
+
+    for (; pos + 32 <= length; pos += 32){
+        check_32(&state, _mm256_loadu_si256((const __m256i *)(input + pos)));
+    }
+
+    if (pos < length){
+        uint8_t tail[32] = {0};
+
+        memcpy(tail, input + pos, length - pos);
+        check_32(&state, _mm256_loadu_si256((const __m256i *)tail));
+    }
+
+    state.error = _mm256_or_si256(state.error, state.incomplete);
+
+    return _mm256_testz_si256(state.error, state.error);
+}
+typedef struct utf8_state_ssse3 {
+    __m128i previous;
+    __m128i incomplete;
+    __m128i error;
+} utf8_state_ssse3;
+
+__attribute__((target("ssse3")))
+static __m128i lookup_16(const uint8_t *table, __m128i nibbles){
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)table), nibbles);
+}
+
+__attribute__((target("ssse3")))
+static void check_16(utf8_state_ssse3 *state, __m128i input){
+    if (!_mm_movemask_epi8(input)){
+        state->error = _mm_or_si128(state->error, state->incomplete);
+
+        return;
+    }
+
+    __m128i low = _mm_set1_epi8(0x0F);
+    __m128i prev1 = _mm_alignr_epi8(input, state->previous, 15);
+    __m128i prev2 = _mm_alignr_epi8(input, state->previous, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, state->previous, 13);
+
+    __m128i special = _mm_and_si128(
+        _mm_and_si128(
+            lookup_16(first_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), low)),
+            lookup_16(first_low, _mm_and_si128(prev1, low))
+        ),
+        lookup_16(second_high, _mm_and_si128(_mm_srli_epi16(input, 4), low))
+    );
+
+    /* two continuations in a row are fine as the 3rd or 4th byte */
+    __m128i continued = _mm_or_si128(
+        _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80))),
+        _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)))
+    );
+
+    continued = _mm_and_si128(continued, _mm_set1_epi8((char)0x80));
+
+    state->error = _mm_or_si128(state->error, _mm_xor_si128(continued, special));
+    state->incomplete = _mm_subs_epu8(
+        input,
+        _mm_loadu_si128((const __m128i *)(incomplete_limits + 16))
+    );
+    state->previous = input;
+}
+
+__attribute__((target("ssse3")))
+static bool validate_ssse3(const uint8_t *input, size_t length){
+    utf8_state_ssse3 state = {
+        _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()
+    };
+    size_t pos = 0;
+
+    for (; pos + 16 <= length; pos += 16){
+        check_16(&state, _mm_loadu_si128((const __m128i *)(input + pos)));
+    }
+
+    if (pos < length){
+        uint8_t tail[16] = {0};
+
+        memcpy(tail, input + pos, length - pos);
+        check_16(&state, _mm_loadu_si128((const __m128i *)tail));
+    }
+
+    state.error = _mm_or_si128(state.error, state.incomplete);
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(state.error, _mm_setzero_si128())) == 0xFFFF;
+}
+#endif
+
+/* returns the length of the sequence or 0 when it is invalid */
+static size_t decode(const uint8_t *input, size_t length, uint32_t *codepoint){
+    uint8_t lead = input[0];
+
+    if (lead < 0x80){
+        *codepoint = lead;
+
+        return 1;
+    }
+    else if (lead < 0xC2){
+        return 0;
+    }
+    else if (lead < 0xE0){
+        if (length < 2 || (input[1] & 0xC0) != 0x80){
+            return 0;
+        }
+
+        *codepoint = (uint32_t)(lead & 0x1F) << 6 | (input[1] & 0x3F);
+
+        return 2;
+    }
+
+    /* the second byte range rules out overlongs, surrogates and > U+10FFFF */
+    uint8_t minimum = 0x80;
+    uint8_t maximum = 0xBF;
+
+    if (lead == 0xE0){
+        minimum = 0xA0;
+    }
+    else if (lead == 0xED){
+        maximum = 0x9F;
+    }
+    else if (lead == 0xF0){
+        minimum = 0x90;
+    }
+    else if (lead == 0xF4){
+        maximum = 0x8F;
+    }
+    else if (lead > 0xF4){
+        return 0;
+    }
+
+    if (lead < 0xF0){
+        if (length < 3 || input[1] < minimum || input[1] > maximum ||
+                (input[2] & 0xC0) != 0x80){
+            return 0;
+        }
+
+        *codepoint = (uint32_t)(lead & 0x0F) << 12 |
+            (uint32_t)(input[1] & 0x3F) << 6 |
+            (input[2] & 0x3F);
+
+        return 3;
+    }
+
+    if (length < 4 || input[1] < minimum || input[1] > maximum ||
+            (input[2] & 0xC0) != 0x80 || (input[3] & 0xC0) != 0x80){
+        return 0;
+    }
+
+    *codepoint = (uint32_t)(lead & 0x07) << 18 |
+        (uint32_t)(input[1] & 0x3F) << 12 |
+        (uint32_t)(input[2] & 0x3F) << 6 |
+        (input[3] & 0x3F);
+
+    return 4;
+}
+
+/* number of leading ascii bytes in the 16 at input */
+static size_t ascii_prefix(const uint8_t *input, bool vector){
+#ifdef __SSE2__
+    if (vector){
+        unsigned mask = (unsigned)_mm_movemask_epi8(
+            _mm_loadu_si128((const __m128i *)input)
+        );
+
+        return mask ? (size_t)__builtin_ctz(mask) : 16;
+    }
+#else
+    (void)vector;
+#endif
+
+    size_t pos = 0;
+
+    while (pos < 16 && input[pos] < 0x80){
+        pos++;
+    }
+
+    return pos;
+}
+
+static bool validate_scalar(const uint8_t *input, size_t length){
+    bool vector = cpu_has(CPU_FEATURE_SSE2);
+    size_t pos = 0;
+    uint32_t codepoint;
+
+    while (pos < length){
+        if (pos + 16 <= length){
+            size_t ascii = ascii_prefix(input + pos, vector);
+
+            pos += ascii;
+
+            if (ascii == 16){
+                continue;
+            }
+        }
+
+        size_t size = decode(input + pos, length - pos, &codepoint);
+
+        if (!size){
+            return false;
+        }
+
+        pos += size;
+    }
+
+    return true;
+}
+
+/* picked once from cpu_has, racing threads pick the same one */
+static utf8_validator get_validator(void){
+    static _Atomic utf8_validator validator = NULL;
+    utf8_validator current = atomic_load_explicit(&validator, memory_order_relaxed);
+
+    if (current){
+        return current;
+    }
+
+    current = validate_scalar;
+
+#ifdef CPU_X86
+    if (cpu_has(CPU_FEATURE_AVX2)){
+        current = validate_avx2;
+    }
+    else if (cpu_has(CPU_FEATURE_SSSE3)){
+        current = validate_ssse3;
+    }
+#endif
+
+    atomic_store_explicit(&validator, current, memory_order_relaxed);
+
+    return current;
+}
+
+bool utf8_validate(const char *input, size_t length){
+    if (!input && length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] utf8_validate() - input is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    return get_validator()((const uint8_t *)input, length);
+}
+
+size_t utf8_length(const char *input, size_t length){
+    if (!input && length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] utf8_length() - input is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    size_t pos = 0;
+    size_t count = 0;
+
+#ifdef __SSE2__
+    if (cpu_has(CPU_FEATURE_SSE2)){
+        /* everything but a continuation byte (0x80 - 0xBF) starts a code point */
+        __m128i continuation = _mm_set1_epi8((char)0xBF);
+
+        for (; pos + 16 <= length; pos += 16){
+            __m128i chars = _mm_loadu_si128((const __m128i *)(input + pos));
+
+            count += (size_t)__builtin_popcount(
+                (unsigned)_mm_movemask_epi8(_mm_cmpgt_epi8(chars, continuation))
+            );
+        }
+    }
+#endif
+
+    for (; pos < length; ++pos){
+        count += ((uint8_t)input[pos] & 0xC0) != 0x80;
+    }
+
+    return count;
+}
+
+size_t utf8_utf16_length(const char *input, size_t length){
+    if (!input && length){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] utf8_utf16_length() - input is NULL\n",
+            __FILE__
+        );
+
+        return 0;
+    }
+
+    size_t pos = 0;
+    size_t count = 0;
+
+#ifdef __SSE2__
+    if (cpu_has(CPU_FEATURE_SSE2)){
+        /* four byte leads (signed 0xF0 - 0xFF) become surrogate pairs */
+        __m128i continuation = _mm_set1_epi8((char)0xBF);
+        __m128i pair = _mm_set1_epi8((char)0xEF);
+
+        for (; pos + 16 <= length; pos += 16){
+            __m128i chars = _mm_loadu_si128((const __m128i *)(input + pos));
+
+            count += (size_t)__builtin_popcount(
+                (unsigned)_mm_movemask_epi8(_mm_cmpgt_epi8(chars, continuation))
+            );
+            count += (size_t)__builtin_popcount(
+                (unsigned)_mm_movemask_epi8(_mm_cmpgt_epi8(chars, pair)) &
+                (unsigned)_mm_movemask_epi8(chars)
+            );
+        }
+    }
+#endif
+
+    for (; pos < length; ++pos){
+        uint8_t c = (uint8_t)input[pos];
+
+        count += ((c & 0xC0) != 0x80) + (c >= 0xF0);
+    }
+
+    return count;
+}
+
+bool utf8_to_utf16(const char *input, size_t length, uint16_t *output, size_t outputsize, size_t *written){
+    if ((!input && length) || !output){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] utf8_to_utf16() - input or output is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)input;
+    size_t pos = 0;
+    size_t out = 0;
+    uint32_t codepoint;
+
+#ifdef __SSE2__
+    bool vector = cpu_has(CPU_FEATURE_SSE2);
+#endif
+
+    while (pos < length){
+        size_t end = length;
+
+        if (pos + 16 <= length && out + 16 <= outputsize){
+#ifdef __SSE2__
+            if (vector){
+                __m128i chars = _mm_loadu_si128((const __m128i *)(bytes + pos));
+
+                if (!_mm_movemask_epi8(chars)){
+                    __m128i zero = _mm_setzero_si128();
+
+                    _mm_storeu_si128((__m128i *)(output + out), _mm_unpacklo_epi8(chars, zero));
+                    _mm_storeu_si128((__m128i *)(output + out + 8), _mm_unpackhi_epi8(chars, zero));
+
+                    pos += 16;
+                    out += 16;
+
+                    continue;
+                }
+            }
+#endif
+
+            /* decode past the non ascii block before trying again */
+            end = pos + 16;
+        }
+
+        while (pos < end){
+            size_t size = decode(bytes + pos, length - pos, &codepoint);
+
+            if (!size){
+                log_write(
+                    logger,
+                    LOG_WARNING,
+                    "[%s] utf8_to_utf16() - input is not valid utf8\n",
+                    __FILE__
+                );
+
+                return false;
+            }
+
+            size_t units = codepoint >= 0x10000 ? 2 : 1;
+
+            if (out + units > outputsize){
+                log_write(
+                    logger,
+                    LOG_WARNING,
+                    "[%s] utf8_to_utf16() - output is too small\n",
+                    __FILE__
+                );
+
+                return false;
+            }
+
+            if (units == 2){
+                codepoint -= 0x10000;
+
+                output[out++] = (uint16_t)(0xD800 + (codepoint >> 10));
+                output[out++] = (uint16_t)(0xDC00 + (codepoint & 0x3FF));
+            }
+            else {
+                output[out++] = (uint16_t)codepoint;
+            }
+
+            pos += size;
+        }
+    }
+
+    if (written){
+        *written = out;
+    }
+
+    return true;
+}
+
+bool utf8_to_utf32(const char *input, size_t length, uint32_t *output, size_t outputsize, size_t *written){
+    if ((!input && length) || !output){
+        log_write(
+            logger,
+            LOG_WARNING,
+            "[%s] utf8_to_utf32() - input or output is NULL\n",
+            __FILE__
+        );
+
+        return false;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)input;
+    bool vector = cpu_has(CPU_FEATURE_SSE2);
+    size_t pos = 0;
+    size_t out = 0;
+
+    while (pos < length){
+        size_t end = length;
+
+        if (pos + 16 <= length && out + 16 <= outputsize){
+            size_t ascii = ascii_prefix(bytes + pos, vector);
+
+            for (size_t index = 0; index < ascii; ++index){
+                output[out + index] = bytes[pos + index];
+            }
+
+            pos += ascii;
+            out += ascii;
+
+            if (ascii == 16){
+                continue;
+            }
+
+            end = pos + 1;
+        }
+
+        while (pos < end){
+            uint32_t codepoint;
+            size_t size = decode(bytes + pos, length - pos, &codepoint);
+
+            if (!size){
+                log_write(
+                    logger,
+                    LOG_WARNING,
+                    "[%s] utf8_to_utf32() - input is not valid utf8\n",
+                    __FILE__
+                );
+
+                return false;
+            }
+            else if (out + 1 > outputsize){
+                log_write(
+                    logger,
+                    LOG_WARNING,
+                    "[%s] utf8_to_utf32() - output is too small\n",
+                    __FILE__
+                );
+
+                return false;
+            }
+
+            output[out++] = codepoint;
+            pos += size;
+        }
+    }
+
+    if (written){
+        *written = out;
+    }
+
+    return true;
+}
@@ -0,0 +1,28 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * strict validation (no overlongs, surrogates or code points
+ * past U+10FFFF) -- with SSSE3 or AVX2 the input is checked a
+ * whole vector at a time using nibble lookup tables
+ */
+bool utf8_validate(const char *, size_t);
+
+/* the input MUST be valid (see utf8_validate) */
+size_t utf8_length(const char *, size_t);
+size_t utf8_utf16_length(const char *, size_t);
+
+/*
+ * transcode into an output of the given size (in units) and set
+ * the number of units written -- false for invalid input or an
+ * output that is too small. the *_length functions give the
+ * exact size needed
+ */
+bool utf8_to_utf16(const char *, size_t, uint16_t *, size_t, size_t *);
+bool utf8_to_utf32(const char *, size_t, uint32_t *, size_t, size_t *);
+
+#endif